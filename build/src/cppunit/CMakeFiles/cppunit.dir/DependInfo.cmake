@@ -0,0 +1,100 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/cppunit/AdditionalMessage.cpp" "src/cppunit/CMakeFiles/cppunit.dir/AdditionalMessage.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/AdditionalMessage.cpp.o.d"
+  "/root/repo/src/cppunit/Asserter.cpp" "src/cppunit/CMakeFiles/cppunit.dir/Asserter.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/Asserter.cpp.o.d"
+  "/root/repo/src/cppunit/BeOsDynamicLibraryManager.cpp" "src/cppunit/CMakeFiles/cppunit.dir/BeOsDynamicLibraryManager.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/BeOsDynamicLibraryManager.cpp.o.d"
+  "/root/repo/src/cppunit/BinaryResultListener.cpp" "src/cppunit/CMakeFiles/cppunit.dir/BinaryResultListener.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/BinaryResultListener.cpp.o.d"
+  "/root/repo/src/cppunit/BinaryResultReader.cpp" "src/cppunit/CMakeFiles/cppunit.dir/BinaryResultReader.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/BinaryResultReader.cpp.o.d"
+  "/root/repo/src/cppunit/BinaryResultWriter.cpp" "src/cppunit/CMakeFiles/cppunit.dir/BinaryResultWriter.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/BinaryResultWriter.cpp.o.d"
+  "/root/repo/src/cppunit/BriefTestProgressListener.cpp" "src/cppunit/CMakeFiles/cppunit.dir/BriefTestProgressListener.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/BriefTestProgressListener.cpp.o.d"
+  "/root/repo/src/cppunit/Clock.cpp" "src/cppunit/CMakeFiles/cppunit.dir/Clock.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/Clock.cpp.o.d"
+  "/root/repo/src/cppunit/CompilerOutputter.cpp" "src/cppunit/CMakeFiles/cppunit.dir/CompilerOutputter.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/CompilerOutputter.cpp.o.d"
+  "/root/repo/src/cppunit/CoverageIndex.cpp" "src/cppunit/CMakeFiles/cppunit.dir/CoverageIndex.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/CoverageIndex.cpp.o.d"
+  "/root/repo/src/cppunit/CoverageListener.cpp" "src/cppunit/CMakeFiles/cppunit.dir/CoverageListener.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/CoverageListener.cpp.o.d"
+  "/root/repo/src/cppunit/DefaultProtector.cpp" "src/cppunit/CMakeFiles/cppunit.dir/DefaultProtector.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/DefaultProtector.cpp.o.d"
+  "/root/repo/src/cppunit/DynamicLibraryManager.cpp" "src/cppunit/CMakeFiles/cppunit.dir/DynamicLibraryManager.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/DynamicLibraryManager.cpp.o.d"
+  "/root/repo/src/cppunit/DynamicLibraryManagerException.cpp" "src/cppunit/CMakeFiles/cppunit.dir/DynamicLibraryManagerException.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/DynamicLibraryManagerException.cpp.o.d"
+  "/root/repo/src/cppunit/Exception.cpp" "src/cppunit/CMakeFiles/cppunit.dir/Exception.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/Exception.cpp.o.d"
+  "/root/repo/src/cppunit/HistoryListener.cpp" "src/cppunit/CMakeFiles/cppunit.dir/HistoryListener.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/HistoryListener.cpp.o.d"
+  "/root/repo/src/cppunit/JournalListener.cpp" "src/cppunit/CMakeFiles/cppunit.dir/JournalListener.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/JournalListener.cpp.o.d"
+  "/root/repo/src/cppunit/LazyTestSuite.cpp" "src/cppunit/CMakeFiles/cppunit.dir/LazyTestSuite.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/LazyTestSuite.cpp.o.d"
+  "/root/repo/src/cppunit/LocalSocket.cpp" "src/cppunit/CMakeFiles/cppunit.dir/LocalSocket.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/LocalSocket.cpp.o.d"
+  "/root/repo/src/cppunit/MappedFile.cpp" "src/cppunit/CMakeFiles/cppunit.dir/MappedFile.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/MappedFile.cpp.o.d"
+  "/root/repo/src/cppunit/Message.cpp" "src/cppunit/CMakeFiles/cppunit.dir/Message.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/Message.cpp.o.d"
+  "/root/repo/src/cppunit/Options.cpp" "src/cppunit/CMakeFiles/cppunit.dir/Options.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/Options.cpp.o.d"
+  "/root/repo/src/cppunit/OutputCapture.cpp" "src/cppunit/CMakeFiles/cppunit.dir/OutputCapture.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/OutputCapture.cpp.o.d"
+  "/root/repo/src/cppunit/PlugInManager.cpp" "src/cppunit/CMakeFiles/cppunit.dir/PlugInManager.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/PlugInManager.cpp.o.d"
+  "/root/repo/src/cppunit/PlugInParameters.cpp" "src/cppunit/CMakeFiles/cppunit.dir/PlugInParameters.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/PlugInParameters.cpp.o.d"
+  "/root/repo/src/cppunit/Protector.cpp" "src/cppunit/CMakeFiles/cppunit.dir/Protector.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/Protector.cpp.o.d"
+  "/root/repo/src/cppunit/ProtectorChain.cpp" "src/cppunit/CMakeFiles/cppunit.dir/ProtectorChain.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/ProtectorChain.cpp.o.d"
+  "/root/repo/src/cppunit/RepeatedTest.cpp" "src/cppunit/CMakeFiles/cppunit.dir/RepeatedTest.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/RepeatedTest.cpp.o.d"
+  "/root/repo/src/cppunit/ResourceUsage.cpp" "src/cppunit/CMakeFiles/cppunit.dir/ResourceUsage.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/ResourceUsage.cpp.o.d"
+  "/root/repo/src/cppunit/ResultComparison.cpp" "src/cppunit/CMakeFiles/cppunit.dir/ResultComparison.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/ResultComparison.cpp.o.d"
+  "/root/repo/src/cppunit/ResultFile.cpp" "src/cppunit/CMakeFiles/cppunit.dir/ResultFile.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/ResultFile.cpp.o.d"
+  "/root/repo/src/cppunit/ShlDynamicLibraryManager.cpp" "src/cppunit/CMakeFiles/cppunit.dir/ShlDynamicLibraryManager.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/ShlDynamicLibraryManager.cpp.o.d"
+  "/root/repo/src/cppunit/SourceLine.cpp" "src/cppunit/CMakeFiles/cppunit.dir/SourceLine.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/SourceLine.cpp.o.d"
+  "/root/repo/src/cppunit/StringTools.cpp" "src/cppunit/CMakeFiles/cppunit.dir/StringTools.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/StringTools.cpp.o.d"
+  "/root/repo/src/cppunit/SynchronizedObject.cpp" "src/cppunit/CMakeFiles/cppunit.dir/SynchronizedObject.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/SynchronizedObject.cpp.o.d"
+  "/root/repo/src/cppunit/Test.cpp" "src/cppunit/CMakeFiles/cppunit.dir/Test.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/Test.cpp.o.d"
+  "/root/repo/src/cppunit/TestAssert.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestAssert.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestAssert.cpp.o.d"
+  "/root/repo/src/cppunit/TestCase.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestCase.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestCase.cpp.o.d"
+  "/root/repo/src/cppunit/TestCaseDecorator.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestCaseDecorator.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestCaseDecorator.cpp.o.d"
+  "/root/repo/src/cppunit/TestCaseTable.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestCaseTable.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestCaseTable.cpp.o.d"
+  "/root/repo/src/cppunit/TestChangeFilter.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestChangeFilter.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestChangeFilter.cpp.o.d"
+  "/root/repo/src/cppunit/TestComposite.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestComposite.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestComposite.cpp.o.d"
+  "/root/repo/src/cppunit/TestDecorator.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestDecorator.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestDecorator.cpp.o.d"
+  "/root/repo/src/cppunit/TestFactoryRegistry.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestFactoryRegistry.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestFactoryRegistry.cpp.o.d"
+  "/root/repo/src/cppunit/TestFailure.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestFailure.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestFailure.cpp.o.d"
+  "/root/repo/src/cppunit/TestHistory.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestHistory.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestHistory.cpp.o.d"
+  "/root/repo/src/cppunit/TestJournal.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestJournal.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestJournal.cpp.o.d"
+  "/root/repo/src/cppunit/TestLeaf.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestLeaf.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestLeaf.cpp.o.d"
+  "/root/repo/src/cppunit/TestListWriter.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestListWriter.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestListWriter.cpp.o.d"
+  "/root/repo/src/cppunit/TestManifest.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestManifest.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestManifest.cpp.o.d"
+  "/root/repo/src/cppunit/TestNameFilter.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestNameFilter.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestNameFilter.cpp.o.d"
+  "/root/repo/src/cppunit/TestNameIndex.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestNameIndex.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestNameIndex.cpp.o.d"
+  "/root/repo/src/cppunit/TestNamer.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestNamer.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestNamer.cpp.o.d"
+  "/root/repo/src/cppunit/TestOrder.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestOrder.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestOrder.cpp.o.d"
+  "/root/repo/src/cppunit/TestPath.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestPath.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestPath.cpp.o.d"
+  "/root/repo/src/cppunit/TestPlugInDefaultImpl.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestPlugInDefaultImpl.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestPlugInDefaultImpl.cpp.o.d"
+  "/root/repo/src/cppunit/TestRecord.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestRecord.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestRecord.cpp.o.d"
+  "/root/repo/src/cppunit/TestRegistrationTable.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestRegistrationTable.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestRegistrationTable.cpp.o.d"
+  "/root/repo/src/cppunit/TestResult.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestResult.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestResult.cpp.o.d"
+  "/root/repo/src/cppunit/TestResultCache.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestResultCache.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestResultCache.cpp.o.d"
+  "/root/repo/src/cppunit/TestResultCollector.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestResultCollector.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestResultCollector.cpp.o.d"
+  "/root/repo/src/cppunit/TestRunner.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestRunner.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestRunner.cpp.o.d"
+  "/root/repo/src/cppunit/TestServer.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestServer.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestServer.cpp.o.d"
+  "/root/repo/src/cppunit/TestSetUp.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestSetUp.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestSetUp.cpp.o.d"
+  "/root/repo/src/cppunit/TestSuccessListener.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestSuccessListener.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestSuccessListener.cpp.o.d"
+  "/root/repo/src/cppunit/TestSuite.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestSuite.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestSuite.cpp.o.d"
+  "/root/repo/src/cppunit/TestSuiteBuilderContext.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TestSuiteBuilderContext.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TestSuiteBuilderContext.cpp.o.d"
+  "/root/repo/src/cppunit/TextOutputter.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TextOutputter.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TextOutputter.cpp.o.d"
+  "/root/repo/src/cppunit/TextTestProgressListener.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TextTestProgressListener.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TextTestProgressListener.cpp.o.d"
+  "/root/repo/src/cppunit/TextTestResult.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TextTestResult.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TextTestResult.cpp.o.d"
+  "/root/repo/src/cppunit/TextTestRunner.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TextTestRunner.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TextTestRunner.cpp.o.d"
+  "/root/repo/src/cppunit/TypeInfoHelper.cpp" "src/cppunit/CMakeFiles/cppunit.dir/TypeInfoHelper.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/TypeInfoHelper.cpp.o.d"
+  "/root/repo/src/cppunit/UnixCoverageListener.cpp" "src/cppunit/CMakeFiles/cppunit.dir/UnixCoverageListener.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/UnixCoverageListener.cpp.o.d"
+  "/root/repo/src/cppunit/UnixDynamicLibraryManager.cpp" "src/cppunit/CMakeFiles/cppunit.dir/UnixDynamicLibraryManager.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/UnixDynamicLibraryManager.cpp.o.d"
+  "/root/repo/src/cppunit/UnixLocalSocket.cpp" "src/cppunit/CMakeFiles/cppunit.dir/UnixLocalSocket.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/UnixLocalSocket.cpp.o.d"
+  "/root/repo/src/cppunit/UnixMappedFile.cpp" "src/cppunit/CMakeFiles/cppunit.dir/UnixMappedFile.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/UnixMappedFile.cpp.o.d"
+  "/root/repo/src/cppunit/UnixOutputCapture.cpp" "src/cppunit/CMakeFiles/cppunit.dir/UnixOutputCapture.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/UnixOutputCapture.cpp.o.d"
+  "/root/repo/src/cppunit/UnixRegularExpression.cpp" "src/cppunit/CMakeFiles/cppunit.dir/UnixRegularExpression.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/UnixRegularExpression.cpp.o.d"
+  "/root/repo/src/cppunit/XmlDocument.cpp" "src/cppunit/CMakeFiles/cppunit.dir/XmlDocument.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/XmlDocument.cpp.o.d"
+  "/root/repo/src/cppunit/XmlElement.cpp" "src/cppunit/CMakeFiles/cppunit.dir/XmlElement.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/XmlElement.cpp.o.d"
+  "/root/repo/src/cppunit/XmlOutputter.cpp" "src/cppunit/CMakeFiles/cppunit.dir/XmlOutputter.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/XmlOutputter.cpp.o.d"
+  "/root/repo/src/cppunit/XmlOutputterHook.cpp" "src/cppunit/CMakeFiles/cppunit.dir/XmlOutputterHook.cpp.o" "gcc" "src/cppunit/CMakeFiles/cppunit.dir/XmlOutputterHook.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,173 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cppunit.dir/AdditionalMessage.cpp.o"
+  "CMakeFiles/cppunit.dir/AdditionalMessage.cpp.o.d"
+  "CMakeFiles/cppunit.dir/Asserter.cpp.o"
+  "CMakeFiles/cppunit.dir/Asserter.cpp.o.d"
+  "CMakeFiles/cppunit.dir/BeOsDynamicLibraryManager.cpp.o"
+  "CMakeFiles/cppunit.dir/BeOsDynamicLibraryManager.cpp.o.d"
+  "CMakeFiles/cppunit.dir/BinaryResultListener.cpp.o"
+  "CMakeFiles/cppunit.dir/BinaryResultListener.cpp.o.d"
+  "CMakeFiles/cppunit.dir/BinaryResultReader.cpp.o"
+  "CMakeFiles/cppunit.dir/BinaryResultReader.cpp.o.d"
+  "CMakeFiles/cppunit.dir/BinaryResultWriter.cpp.o"
+  "CMakeFiles/cppunit.dir/BinaryResultWriter.cpp.o.d"
+  "CMakeFiles/cppunit.dir/BriefTestProgressListener.cpp.o"
+  "CMakeFiles/cppunit.dir/BriefTestProgressListener.cpp.o.d"
+  "CMakeFiles/cppunit.dir/Clock.cpp.o"
+  "CMakeFiles/cppunit.dir/Clock.cpp.o.d"
+  "CMakeFiles/cppunit.dir/CompilerOutputter.cpp.o"
+  "CMakeFiles/cppunit.dir/CompilerOutputter.cpp.o.d"
+  "CMakeFiles/cppunit.dir/CoverageIndex.cpp.o"
+  "CMakeFiles/cppunit.dir/CoverageIndex.cpp.o.d"
+  "CMakeFiles/cppunit.dir/CoverageListener.cpp.o"
+  "CMakeFiles/cppunit.dir/CoverageListener.cpp.o.d"
+  "CMakeFiles/cppunit.dir/DefaultProtector.cpp.o"
+  "CMakeFiles/cppunit.dir/DefaultProtector.cpp.o.d"
+  "CMakeFiles/cppunit.dir/DynamicLibraryManager.cpp.o"
+  "CMakeFiles/cppunit.dir/DynamicLibraryManager.cpp.o.d"
+  "CMakeFiles/cppunit.dir/DynamicLibraryManagerException.cpp.o"
+  "CMakeFiles/cppunit.dir/DynamicLibraryManagerException.cpp.o.d"
+  "CMakeFiles/cppunit.dir/Exception.cpp.o"
+  "CMakeFiles/cppunit.dir/Exception.cpp.o.d"
+  "CMakeFiles/cppunit.dir/HistoryListener.cpp.o"
+  "CMakeFiles/cppunit.dir/HistoryListener.cpp.o.d"
+  "CMakeFiles/cppunit.dir/JournalListener.cpp.o"
+  "CMakeFiles/cppunit.dir/JournalListener.cpp.o.d"
+  "CMakeFiles/cppunit.dir/LazyTestSuite.cpp.o"
+  "CMakeFiles/cppunit.dir/LazyTestSuite.cpp.o.d"
+  "CMakeFiles/cppunit.dir/LocalSocket.cpp.o"
+  "CMakeFiles/cppunit.dir/LocalSocket.cpp.o.d"
+  "CMakeFiles/cppunit.dir/MappedFile.cpp.o"
+  "CMakeFiles/cppunit.dir/MappedFile.cpp.o.d"
+  "CMakeFiles/cppunit.dir/Message.cpp.o"
+  "CMakeFiles/cppunit.dir/Message.cpp.o.d"
+  "CMakeFiles/cppunit.dir/Options.cpp.o"
+  "CMakeFiles/cppunit.dir/Options.cpp.o.d"
+  "CMakeFiles/cppunit.dir/OutputCapture.cpp.o"
+  "CMakeFiles/cppunit.dir/OutputCapture.cpp.o.d"
+  "CMakeFiles/cppunit.dir/PlugInManager.cpp.o"
+  "CMakeFiles/cppunit.dir/PlugInManager.cpp.o.d"
+  "CMakeFiles/cppunit.dir/PlugInParameters.cpp.o"
+  "CMakeFiles/cppunit.dir/PlugInParameters.cpp.o.d"
+  "CMakeFiles/cppunit.dir/Protector.cpp.o"
+  "CMakeFiles/cppunit.dir/Protector.cpp.o.d"
+  "CMakeFiles/cppunit.dir/ProtectorChain.cpp.o"
+  "CMakeFiles/cppunit.dir/ProtectorChain.cpp.o.d"
+  "CMakeFiles/cppunit.dir/RepeatedTest.cpp.o"
+  "CMakeFiles/cppunit.dir/RepeatedTest.cpp.o.d"
+  "CMakeFiles/cppunit.dir/ResourceUsage.cpp.o"
+  "CMakeFiles/cppunit.dir/ResourceUsage.cpp.o.d"
+  "CMakeFiles/cppunit.dir/ResultComparison.cpp.o"
+  "CMakeFiles/cppunit.dir/ResultComparison.cpp.o.d"
+  "CMakeFiles/cppunit.dir/ResultFile.cpp.o"
+  "CMakeFiles/cppunit.dir/ResultFile.cpp.o.d"
+  "CMakeFiles/cppunit.dir/ShlDynamicLibraryManager.cpp.o"
+  "CMakeFiles/cppunit.dir/ShlDynamicLibraryManager.cpp.o.d"
+  "CMakeFiles/cppunit.dir/SourceLine.cpp.o"
+  "CMakeFiles/cppunit.dir/SourceLine.cpp.o.d"
+  "CMakeFiles/cppunit.dir/StringTools.cpp.o"
+  "CMakeFiles/cppunit.dir/StringTools.cpp.o.d"
+  "CMakeFiles/cppunit.dir/SynchronizedObject.cpp.o"
+  "CMakeFiles/cppunit.dir/SynchronizedObject.cpp.o.d"
+  "CMakeFiles/cppunit.dir/Test.cpp.o"
+  "CMakeFiles/cppunit.dir/Test.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestAssert.cpp.o"
+  "CMakeFiles/cppunit.dir/TestAssert.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestCase.cpp.o"
+  "CMakeFiles/cppunit.dir/TestCase.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestCaseDecorator.cpp.o"
+  "CMakeFiles/cppunit.dir/TestCaseDecorator.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestCaseTable.cpp.o"
+  "CMakeFiles/cppunit.dir/TestCaseTable.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestChangeFilter.cpp.o"
+  "CMakeFiles/cppunit.dir/TestChangeFilter.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestComposite.cpp.o"
+  "CMakeFiles/cppunit.dir/TestComposite.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestDecorator.cpp.o"
+  "CMakeFiles/cppunit.dir/TestDecorator.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestFactoryRegistry.cpp.o"
+  "CMakeFiles/cppunit.dir/TestFactoryRegistry.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestFailure.cpp.o"
+  "CMakeFiles/cppunit.dir/TestFailure.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestHistory.cpp.o"
+  "CMakeFiles/cppunit.dir/TestHistory.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestJournal.cpp.o"
+  "CMakeFiles/cppunit.dir/TestJournal.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestLeaf.cpp.o"
+  "CMakeFiles/cppunit.dir/TestLeaf.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestListWriter.cpp.o"
+  "CMakeFiles/cppunit.dir/TestListWriter.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestManifest.cpp.o"
+  "CMakeFiles/cppunit.dir/TestManifest.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestNameFilter.cpp.o"
+  "CMakeFiles/cppunit.dir/TestNameFilter.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestNameIndex.cpp.o"
+  "CMakeFiles/cppunit.dir/TestNameIndex.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestNamer.cpp.o"
+  "CMakeFiles/cppunit.dir/TestNamer.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestOrder.cpp.o"
+  "CMakeFiles/cppunit.dir/TestOrder.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestPath.cpp.o"
+  "CMakeFiles/cppunit.dir/TestPath.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestPlugInDefaultImpl.cpp.o"
+  "CMakeFiles/cppunit.dir/TestPlugInDefaultImpl.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestRecord.cpp.o"
+  "CMakeFiles/cppunit.dir/TestRecord.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestRegistrationTable.cpp.o"
+  "CMakeFiles/cppunit.dir/TestRegistrationTable.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestResult.cpp.o"
+  "CMakeFiles/cppunit.dir/TestResult.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestResultCache.cpp.o"
+  "CMakeFiles/cppunit.dir/TestResultCache.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestResultCollector.cpp.o"
+  "CMakeFiles/cppunit.dir/TestResultCollector.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestRunner.cpp.o"
+  "CMakeFiles/cppunit.dir/TestRunner.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestServer.cpp.o"
+  "CMakeFiles/cppunit.dir/TestServer.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestSetUp.cpp.o"
+  "CMakeFiles/cppunit.dir/TestSetUp.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestSuccessListener.cpp.o"
+  "CMakeFiles/cppunit.dir/TestSuccessListener.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestSuite.cpp.o"
+  "CMakeFiles/cppunit.dir/TestSuite.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TestSuiteBuilderContext.cpp.o"
+  "CMakeFiles/cppunit.dir/TestSuiteBuilderContext.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TextOutputter.cpp.o"
+  "CMakeFiles/cppunit.dir/TextOutputter.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TextTestProgressListener.cpp.o"
+  "CMakeFiles/cppunit.dir/TextTestProgressListener.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TextTestResult.cpp.o"
+  "CMakeFiles/cppunit.dir/TextTestResult.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TextTestRunner.cpp.o"
+  "CMakeFiles/cppunit.dir/TextTestRunner.cpp.o.d"
+  "CMakeFiles/cppunit.dir/TypeInfoHelper.cpp.o"
+  "CMakeFiles/cppunit.dir/TypeInfoHelper.cpp.o.d"
+  "CMakeFiles/cppunit.dir/UnixCoverageListener.cpp.o"
+  "CMakeFiles/cppunit.dir/UnixCoverageListener.cpp.o.d"
+  "CMakeFiles/cppunit.dir/UnixDynamicLibraryManager.cpp.o"
+  "CMakeFiles/cppunit.dir/UnixDynamicLibraryManager.cpp.o.d"
+  "CMakeFiles/cppunit.dir/UnixLocalSocket.cpp.o"
+  "CMakeFiles/cppunit.dir/UnixLocalSocket.cpp.o.d"
+  "CMakeFiles/cppunit.dir/UnixMappedFile.cpp.o"
+  "CMakeFiles/cppunit.dir/UnixMappedFile.cpp.o.d"
+  "CMakeFiles/cppunit.dir/UnixOutputCapture.cpp.o"
+  "CMakeFiles/cppunit.dir/UnixOutputCapture.cpp.o.d"
+  "CMakeFiles/cppunit.dir/UnixRegularExpression.cpp.o"
+  "CMakeFiles/cppunit.dir/UnixRegularExpression.cpp.o.d"
+  "CMakeFiles/cppunit.dir/XmlDocument.cpp.o"
+  "CMakeFiles/cppunit.dir/XmlDocument.cpp.o.d"
+  "CMakeFiles/cppunit.dir/XmlElement.cpp.o"
+  "CMakeFiles/cppunit.dir/XmlElement.cpp.o.d"
+  "CMakeFiles/cppunit.dir/XmlOutputter.cpp.o"
+  "CMakeFiles/cppunit.dir/XmlOutputter.cpp.o.d"
+  "CMakeFiles/cppunit.dir/XmlOutputterHook.cpp.o"
+  "CMakeFiles/cppunit.dir/XmlOutputterHook.cpp.o.d"
+  "libcppunit.a"
+  "libcppunit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cppunit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cppunit_coverage.dir/CoverageRecorder.cpp.o"
+  "CMakeFiles/cppunit_coverage.dir/CoverageRecorder.cpp.o.d"
+  "libcppunit_coverage.a"
+  "libcppunit_coverage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cppunit_coverage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libcppunit_coverage.a"
+)
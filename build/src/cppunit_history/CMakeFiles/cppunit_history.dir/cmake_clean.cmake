@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cppunit_history.dir/cppunit_history.cpp.o"
+  "CMakeFiles/cppunit_history.dir/cppunit_history.cpp.o.d"
+  "cppunit_history"
+  "cppunit_history.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cppunit_history.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
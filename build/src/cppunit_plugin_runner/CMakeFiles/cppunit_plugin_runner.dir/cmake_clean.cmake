@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cppunit_plugin_runner.dir/cppunit_plugin_runner.cpp.o"
+  "CMakeFiles/cppunit_plugin_runner.dir/cppunit_plugin_runner.cpp.o.d"
+  "cppunit_plugin_runner"
+  "cppunit_plugin_runner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cppunit_plugin_runner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
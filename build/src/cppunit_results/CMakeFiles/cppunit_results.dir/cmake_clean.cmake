@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cppunit_results.dir/cppunit_results.cpp.o"
+  "CMakeFiles/cppunit_results.dir/cppunit_results.cpp.o.d"
+  "cppunit_results"
+  "cppunit_results.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cppunit_results.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
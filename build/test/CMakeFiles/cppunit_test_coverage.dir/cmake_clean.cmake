@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cppunit_test_coverage.dir/cppunit_test.cpp.o"
+  "CMakeFiles/cppunit_test_coverage.dir/cppunit_test.cpp.o.d"
+  "cppunit_test_coverage"
+  "cppunit_test_coverage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cppunit_test_coverage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
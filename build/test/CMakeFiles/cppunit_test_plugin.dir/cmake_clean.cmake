@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cppunit_test_plugin.dir/cppunit_test_plugin.cpp.o"
+  "CMakeFiles/cppunit_test_plugin.dir/cppunit_test_plugin.cpp.o.d"
+  "cppunit_test_plugin.pdb"
+  "cppunit_test_plugin.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cppunit_test_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,55 @@
+#ifndef CPPUNIT_BINARYRESULTLISTENER_H
+#define CPPUNIT_BINARYRESULTLISTENER_H
+
+#include <cppunit/BinaryResultWriter.h>
+#include <cppunit/TestListener.h>
+#include <fstream>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief TestListener that writes the test results in the binary result format.
+ * \ingroup TrackingTestExecution
+ *
+ * Each test is written when it ends, so the file holds the results of the
+ * tests that ran even if the process does not end normally. The files of
+ * several runs can be merged and converted with the cppunit_results tool.
+ *
+ * \see BinaryResultWriter.
+ */
+class CPPUNIT_API BinaryResultListener : public TestListener
+{
+public:
+	/*! \brief Constructs a BinaryResultListener object.
+	 * \param fileName Name of the result file, truncated if it exists.
+	 * \exception std::runtime_error if the file can not be created.
+	 */
+	BinaryResultListener(const std::string& fileName);
+
+	/// Destructor.
+	virtual ~BinaryResultListener();
+
+	void startTest(Test* test);
+	void addFailure(const TestFailure& failure);
+	void endTest(Test* test);
+	void endTestRun(Test* test, TestResult* eventManager);
+
+private:
+	/// Prevents the use of the copy constructor.
+	BinaryResultListener(const BinaryResultListener& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const BinaryResultListener& copy);
+
+private:
+	std::ofstream       m_stream;
+	BinaryResultWriter* m_writer;
+	TestRecord          m_record;
+	unsigned long long  m_startTime;
+};
+
+
+CPPUNIT_NS_END
+
+#endif  // CPPUNIT_BINARYRESULTLISTENER_H
@@ -0,0 +1,84 @@
+#ifndef CPPUNIT_BINARYRESULTREADER_H
+#define CPPUNIT_BINARYRESULTREADER_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/TestRecord.h>
+#include <cppunit/portability/CppUnitMap.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <istream>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief Reads test records written by a BinaryResultWriter.
+ * \ingroup BrowsingCollectedTestResult
+ *
+ * Records are read one at a time: only the interned names and the failures
+ * not yet referenced by a test are kept in memory.
+ *
+ * \code
+ * std::ifstream stream( "results.bin", std::ios::binary );
+ * CppUnit::BinaryResultReader reader( stream );
+ * CppUnit::TestRecord record;
+ * while ( reader.read( record ) )
+ *   ...
+ * \endcode
+ *
+ * A file truncated in the middle of a record (the process writing it was
+ * killed) is read up to the last complete record.
+ */
+class CPPUNIT_API BinaryResultReader
+{
+public:
+	/*! \brief Constructs a reader and checks the file header.
+	 * \param stream Stream to read the records from. Must be opened in binary mode.
+	 * \exception std::runtime_error if the stream is not a binary result file.
+	 */
+	BinaryResultReader(std::istream& stream);
+
+	/// Destructor.
+	virtual ~BinaryResultReader();
+
+	/*! \brief Reads the next test record.
+	 * \param record Receives the test record.
+	 * \return \c true if a record was read, \c false at the end of the file.
+	 * \exception std::runtime_error if the file is corrupted.
+	 */
+	bool read(TestRecord& record);
+
+	/// Tests if the stream starts like a binary result file. Does not consume it.
+	static bool isBinaryResult(std::istream& stream);
+
+private:
+	bool readRecord(unsigned int& kind, std::string& payload);
+
+	/// Prevents the use of the copy constructor.
+	BinaryResultReader(const BinaryResultReader& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const BinaryResultReader& copy);
+
+private:
+	typedef CppUnitMap<unsigned int, TestRecord, std::less<unsigned int> > PendingFailures;
+
+	std::istream&              m_stream;
+	CppUnitVector<std::string> m_names;
+	PendingFailures            m_failures;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_BINARYRESULTREADER_H
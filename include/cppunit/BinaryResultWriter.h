@@ -0,0 +1,95 @@
+#ifndef CPPUNIT_BINARYRESULTWRITER_H
+#define CPPUNIT_BINARYRESULTWRITER_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/TestRecord.h>
+#include <cppunit/portability/CppUnitMap.h>
+#include <ostream>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief Writes test records in the compact binary result format.
+ * \ingroup WritingTestResult
+ *
+ * The file starts with an 8 bytes magic and a version number, followed by
+ * records. Each record is prefixed by its length and kind, so readers can
+ * skip the kinds they do not know. All integers are little endian.
+ *
+ * - A \e name record assigns an id to a test name. Names are written once and
+ *   referenced by id afterward.
+ * - A \e failure record holds the message, location and captured output of a
+ *   failure. It is written just before the test that references it, which
+ *   keeps test records small and fixed-size.
+ * - A \e test record holds the name id, status, duration and failure id.
+ *
+ * Records are written as they come, so a file can be produced incrementally
+ * (see BinaryResultListener) and files can be merged in a single pass.
+ *
+ * \see BinaryResultReader.
+ */
+class CPPUNIT_API BinaryResultWriter
+{
+public:
+	/*! \brief Constructs a writer and writes the file header.
+	 * \param stream Stream the records are written to. Must be opened in binary mode.
+	 */
+	BinaryResultWriter(std::ostream& stream);
+
+	/// Destructor.
+	virtual ~BinaryResultWriter();
+
+	/// Writes the specified test record.
+	void write(const TestRecord& record);
+
+	/// Flushes the stream.
+	void flush();
+
+	/// Magic bytes at the start of a binary result file.
+	static const char magic[8];
+
+	/// Version of the format.
+	static const unsigned int version;
+
+	/// Kinds of record.
+	enum RecordKind
+	{
+		nameRecord = 1,
+		failureRecord,
+		testRecord
+	};
+
+private:
+	unsigned int nameId(const std::string& name);
+	void writeRecord(RecordKind kind, const std::string& payload);
+
+	/// Prevents the use of the copy constructor.
+	BinaryResultWriter(const BinaryResultWriter& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const BinaryResultWriter& copy);
+
+private:
+	typedef CppUnitMap<std::string, unsigned int, std::less<std::string> > NameIds;
+
+	std::ostream& m_stream;
+	NameIds      m_names;
+	unsigned int m_failureCount;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_BINARYRESULTWRITER_H
@@ -119,6 +119,7 @@ public:
   virtual void printFailureType( TestFailure *failure );
   virtual void printFailedTestName( TestFailure *failure );
   virtual void printFailureMessage( TestFailure *failure );
+  virtual void printCapturedOutput( TestFailure *failure );
 
 private:
   /// Prevents the use of the copy constructor.
@@ -0,0 +1,116 @@
+#ifndef CPPUNIT_COVERAGEINDEX_H
+#define CPPUNIT_COVERAGEINDEX_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/portability/CppUnitMap.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief Index of the source lines covered by each test.
+ * \ingroup WritingTestResult
+ *
+ * The index is a text file. Source files are numbered once, then each test
+ * lists the lines it covered in each file, as ranges:
+ * \code
+ * CppUnit coverage index 1
+ * file	0	/src/foo/Foo.cpp
+ * test	FooTest::testBar
+ * lines	0	10-14,18,20-22
+ * \endcode
+ *
+ * Fields are separated by tabs. Tests are identified by their scoped name.
+ *
+ * \see CoverageListener.
+ */
+class CPPUNIT_API CoverageIndex
+{
+public:
+	/// Sorted line numbers.
+	typedef CppUnitVector<unsigned int> Lines;
+
+	/// Constructs an empty index.
+	CoverageIndex();
+
+	/// Destructor.
+	virtual ~CoverageIndex();
+
+	/*! \brief Adds a test without any covered line.
+	 *
+	 * If the test is already in the index, its lines are removed.
+	 * \return Index of the test.
+	 */
+	unsigned int addTest(const std::string& name);
+
+	/// Adds a line covered by a test.
+	void addLine(unsigned int test, const std::string& fileName, unsigned int line);
+
+	/// Returns the number of tests.
+	unsigned int testCount() const;
+
+	/// Returns the scoped name of a test.
+	const std::string& testName(unsigned int test) const;
+
+	/// Returns the index of a test, -1 if it is not in the index.
+	int findTest(const std::string& name) const;
+
+	/// Returns the number of source files.
+	unsigned int fileCount() const;
+
+	/// Returns the name of a source file.
+	const std::string& fileName(unsigned int file) const;
+
+	/// Returns the index of a source file, -1 if it is not in the index.
+	int findFile(const std::string& fileName) const;
+
+	/// Returns the lines of a file covered by a test, empty if none.
+	const Lines& lines(unsigned int test, unsigned int file) const;
+
+	/// Tests if a test covered a line of a file within [first, last].
+	bool covers(unsigned int test, unsigned int file, unsigned int first, unsigned int last) const;
+
+	/*! \brief Reads an index file, replacing the content of the index.
+	 * \return \c false if the file does not exist or is not an index. The
+	 *         index is then left empty.
+	 */
+	bool read(const std::string& fileName);
+
+	/*! \brief Writes the index file.
+	 * \exception std::runtime_error if the file can not be written.
+	 */
+	void write(const std::string& fileName) const;
+
+private:
+	typedef CppUnitMap<unsigned int, Lines, std::less<unsigned int> > FileLines;
+	typedef CppUnitVector<FileLines> TestLines;
+	typedef CppUnitMap<std::string, unsigned int, std::less<std::string> > Indexes;
+
+	void clear();
+	unsigned int addFile(const std::string& fileName);
+
+private:
+	CppUnitVector<std::string> m_testNames;
+	TestLines                  m_testLines;
+	Indexes                    m_testIndexes;
+	CppUnitVector<std::string> m_fileNames;
+	Indexes                    m_fileIndexes;
+	Lines                      m_noLines;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_COVERAGEINDEX_H
@@ -0,0 +1,125 @@
+#ifndef CPPUNIT_COVERAGELISTENER_H
+#define CPPUNIT_COVERAGELISTENER_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/SourceLine.h>
+#include <cppunit/TestListener.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <string>
+#include <stddef.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief TestListener that records the source lines run by each test.
+ * \ingroup TrackingTestExecution
+ *
+ * The code under test must be compiled with <tt>-fsanitize-coverage=trace-pc</tt>
+ * (gcc, clang) or <tt>-fsanitize-coverage=trace-pc-guard</tt> (clang), and with
+ * debug information, and the test binary must link the \c cppunit_coverage
+ * library, which provides the callbacks of the instrumentation. They are not
+ * in the CppUnit library, as they would replace the ones of the sanitizers
+ * (ASan, libFuzzer...) in any binary linking it. While a test runs, the
+ * address of each basic block reached is added to an in-memory set, only
+ * once. With trace-pc-guard, a guard is disabled once hit, so a loop costs a
+ * single call per test.
+ *
+ * The addresses are mapped to source lines once, when the index is written,
+ * by running \c addr2line (GNU binutils) through popen(): it must be found in
+ * the \c PATH. The index keeps the tests of an existing index file that were
+ * not run, so that a partial run updates the index. Mapping the addresses is
+ * only supported on Unix.
+ *
+ * \internal Implementation of the OS independent methods is in CoverageListener.cpp,
+ * the OS specific methods are in UnixCoverageListener.cpp and Win32CoverageListener.cpp.
+ * The callbacks are in CoverageRecorder.cpp, built as the cppunit_coverage library.
+ *
+ * \see CoverageIndex.
+ */
+class CPPUNIT_API CoverageListener : public TestListener
+{
+public:
+	/*! \brief Constructs a CoverageListener object.
+	 * \param fileName Path of the coverage index.
+	 */
+	CoverageListener(const std::string& fileName);
+
+	/// Destructor.
+	virtual ~CoverageListener();
+
+	void startTest(Test* test);
+	void endTest(Test* test);
+
+	/*! \brief Maps the recorded addresses to source lines and writes the index.
+	 * \exception std::runtime_error if the code is not instrumented, or if the
+	 *            addresses can not be mapped, or if the index can not be written.
+	 */
+	void write();
+
+	/// Indicates if instrumented code was run in the process.
+	static bool isInstrumented();
+
+	/*! \brief (INTERNAL) Records the addresses reached by the instrumented code.
+	 *
+	 * Implemented by the cppunit_coverage library.
+	 */
+	struct Recorder
+	{
+		/// Starts recording, forgetting the addresses recorded before.
+		void (*start)();
+
+		/*! Stops recording.
+		 * \param count Receives the number of addresses, \c NULL to discard them.
+		 * \return The addresses, to free(); \c NULL if discarded or on failure.
+		 */
+		size_t* (*stop)(size_t* count);
+
+		/// Indicates if instrumented code was run.
+		bool (*isInstrumented)();
+	};
+
+	/// (INTERNAL) Sets the recorder, called by the cppunit_coverage library.
+	static void setRecorder(const Recorder* recorder);
+
+private:
+	typedef CppUnitVector<size_t> Addresses;
+
+	struct TestAddresses
+	{
+		std::string name;
+		Addresses   addresses;
+	};
+
+	/*! \brief Maps code addresses of the process to source lines.
+	 * \param addresses Sorted addresses.
+	 * \param lines Receives the line of each address, an empty SourceLine if unknown.
+	 * \return \c false on failure.
+	 */
+	bool doMapLines(const Addresses& addresses, CppUnitVector<SourceLine>& lines);
+
+	/// Prevents the use of the copy constructor.
+	CoverageListener(const CoverageListener& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const CoverageListener& copy);
+
+private:
+	std::string                   m_fileName;
+	CppUnitVector<TestAddresses>  m_tests;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_COVERAGELISTENER_H
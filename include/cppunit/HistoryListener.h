@@ -0,0 +1,58 @@
+#ifndef CPPUNIT_HISTORYLISTENER_H
+#define CPPUNIT_HISTORYLISTENER_H
+
+#include <cppunit/TestHistory.h>
+#include <cppunit/TestListener.h>
+#include <cppunit/tools/ResourceUsage.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief TestListener that appends the results of the run to a TestHistory.
+ * \ingroup TrackingTestExecution
+ *
+ * All the test runs made while the listener is registered are recorded as a
+ * single run of the history. The rows are kept in memory and appended to the
+ * history when a test run ends. Use the cppunit_history tool to query the history.
+ *
+ * \see TestHistory.
+ */
+class CPPUNIT_API HistoryListener : public TestListener
+{
+public:
+	/*! \brief Constructs a HistoryListener object.
+	 * \param directory Directory of the history store.
+	 * \exception std::runtime_error if the store can not be opened.
+	 */
+	HistoryListener(const std::string& directory);
+
+	/// Destructor.
+	virtual ~HistoryListener();
+
+	void startTest(Test* test);
+	void addFailure(const TestFailure& failure);
+	void endTest(Test* test);
+	void endTestRun(Test* test, TestResult* eventManager);
+
+private:
+	/// Prevents the use of the copy constructor.
+	HistoryListener(const HistoryListener& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const HistoryListener& copy);
+
+private:
+	TestHistory         m_history;
+	unsigned int        m_runId;
+	bool                m_hasRun;
+	TestHistory::Rows   m_rows;
+	TestHistory::Row    m_row;
+	unsigned long long  m_startTime;
+	ResourceUsage       m_startUsage;
+};
+
+
+CPPUNIT_NS_END
+
+#endif  // CPPUNIT_HISTORYLISTENER_H
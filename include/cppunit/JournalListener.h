@@ -0,0 +1,77 @@
+#ifndef CPPUNIT_JOURNALLISTENER_H
+#define CPPUNIT_JOURNALLISTENER_H
+
+#include <cppunit/TestFilter.h>
+#include <cppunit/TestJournal.h>
+#include <cppunit/TestListener.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief TestListener that records the tests run in a TestJournal.
+ * \ingroup TrackingTestExecution
+ *
+ * The journal survives the process being killed, so a long run can be resumed
+ * where it stopped: construct the listener with \a resume set to \c true, register
+ * it as a TestFilter to skip the tests that already finished, and replay() their
+ * results into the TestResultCollector used for the final report.
+ *
+ * \code
+ * CppUnit::JournalListener journal( "results.journal", true );
+ * controller.addListener( &journal );
+ * controller.addFilter( &journal );
+ * journal.replay( suite, &collector );
+ * \endcode
+ *
+ * A test that was running when the process died is not run again. It is
+ * reported as an error.
+ *
+ * \see TestJournal.
+ */
+class CPPUNIT_API JournalListener : public TestListener, public TestFilter
+{
+public:
+	/*! \brief Constructs a JournalListener object.
+	 * \param fileName Name of the journal file.
+	 * \param resume If \c true, the tests recorded in the existing journal are
+	 *               considered finished. Otherwise the journal is emptied.
+	 * \exception std::runtime_error if the journal can not be opened.
+	 */
+	JournalListener(const std::string& fileName, bool resume = false);
+
+	/// Destructor.
+	virtual ~JournalListener();
+
+	/*! \brief Replays the results of the finished tests.
+	 *
+	 * For each test case of \a root recorded in the journal when it was opened,
+	 * \a listener receives startTest(), addFailure() if the test failed, and endTest().
+	 */
+	void replay(Test* root, TestListener* listener) const;
+
+	/// Accepts the test cases that did not finish in the resumed journal.
+	bool accept(Test* test) const;
+
+	void startTest(Test* test);
+	void addFailure(const TestFailure& failure);
+	void endTest(Test* test);
+	void endTestRun(Test* test, TestResult* eventManager);
+
+private:
+	/// Prevents the use of the copy constructor.
+	JournalListener(const JournalListener& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const JournalListener& copy);
+
+private:
+	TestJournal          m_journal;
+	TestJournal::Status  m_status;
+	unsigned long long   m_startTime;
+};
+
+
+CPPUNIT_NS_END
+
+#endif  // CPPUNIT_JOURNALLISTENER_H
@@ -8,7 +8,7 @@
 #pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
 #endif
 
-#include <cppunit/portability/CppUnitDeque.h>
+#include <cppunit/portability/CppUnitVector.h>
 #include <string>
 
 
@@ -16,7 +16,7 @@ CPPUNIT_NS_BEGIN
 
 
 #if CPPUNIT_NEED_DLL_DECL
-//  template class CPPUNIT_API std::deque<std::string>;
+//  template class CPPUNIT_API std::vector<std::string>;
 #endif
 
 /*! \brief Message associated to an Exception.
@@ -143,7 +143,7 @@ public:
 private:
   std::string m_shortDescription;
 
-  typedef CppUnitDeque<std::string> Details;
+  typedef CppUnitVector<std::string> Details;
   Details m_details;
 };
 
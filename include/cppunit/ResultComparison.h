@@ -0,0 +1,108 @@
+#ifndef CPPUNIT_RESULTCOMPARISON_H
+#define CPPUNIT_RESULTCOMPARISON_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/ResultFile.h>
+#include <cppunit/TestListener.h>
+#include <cppunit/portability/CppUnitMap.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <cppunit/portability/Stream.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief TestListener that compares the run to the results of a previous run.
+ * \ingroup TrackingTestExecution
+ *
+ * The tests of the current run are matched to the previous records by scoped
+ * name, or by name when the previous results do not have the scoped names
+ * (xml results). After the run, write() reports:
+ * - the new failures: tests that fail now and did not fail in the previous run,
+ * - the fixed tests: tests that failed in the previous run and succeed now,
+ * - the slowdowns: successful tests whose duration grew by more than the
+ *   threshold, and by at least the minimal slowdown to ignore timer noise.
+ *
+ * \code
+ * CppUnit::ResultFile::Records previous;
+ * CppUnit::ResultFile::load( "last-green.bin", previous );
+ * CppUnit::ResultComparison comparison( previous, 20 );
+ * eventManager.addListener( &comparison );
+ * runner.run( eventManager );
+ * comparison.write( std::cout );
+ * \endcode
+ *
+ * \see ResultFile.
+ */
+class CPPUNIT_API ResultComparison : public TestListener
+{
+public:
+	/*! \brief Constructs a ResultComparison object.
+	 * \param previous Records of the previous run.
+	 * \param threshold Slowdown reported, in percent of the previous duration.
+	 * \param minimumSlowdown Smallest slowdown reported, in microseconds.
+	 */
+	ResultComparison(const ResultFile::Records& previous, unsigned int threshold = 20, unsigned long long minimumSlowdown = 1000);
+
+	/// Destructor.
+	virtual ~ResultComparison();
+
+	void startTest(Test* test);
+	void addFailure(const TestFailure& failure);
+	void endTest(Test* test);
+
+	/// Names of the tests that fail in this run and did not fail in the previous one.
+	const CppUnitVector<std::string>& newFailures() const;
+
+	/// Names of the tests that failed in the previous run and succeed in this one.
+	const CppUnitVector<std::string>& fixedTests() const;
+
+	/// Indicates if a test got slower than the threshold.
+	bool hasSlowdowns() const;
+
+	/// Prints the report.
+	void write(OStream& stream) const;
+
+private:
+	struct Slowdown
+	{
+		std::string        name;
+		unsigned long long previous;
+		unsigned long long current;
+	};
+
+	const TestRecord* findPrevious(Test* test) const;
+
+	/// Prevents the use of the copy constructor.
+	ResultComparison(const ResultComparison& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const ResultComparison& copy);
+
+private:
+	typedef CppUnitMap<std::string, TestRecord, std::less<std::string> > PreviousRecords;
+
+	PreviousRecords            m_previous;
+	unsigned int               m_threshold;
+	unsigned long long         m_minimumSlowdown;
+	CppUnitVector<std::string> m_newFailures;
+	CppUnitVector<std::string> m_fixedTests;
+	CppUnitVector<Slowdown>    m_slowdowns;
+	bool                       m_failed;
+	unsigned long long         m_startTime;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_RESULTCOMPARISON_H
@@ -0,0 +1,57 @@
+#ifndef CPPUNIT_RESULTFILE_H
+#define CPPUNIT_RESULTFILE_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/TestRecord.h>
+#include <cppunit/portability/CppUnitDeque.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief Loads the results of a previous run.
+ * \ingroup BrowsingCollectedTestResult
+ *
+ * Two formats are recognized: the binary result format (see BinaryResultWriter)
+ * and the xml format written by XmlOutputter. The xml format has no duration
+ * and names the tests with Test::getName(): records loaded from it have a
+ * duration of 0 and the name of the test, not its scoped name.
+ */
+struct CPPUNIT_API ResultFile
+{
+	typedef CppUnitDeque<TestRecord> Records;
+
+	/*! \brief Loads the test records of the specified file.
+	 * \param fileName Name of the result file.
+	 * \param records Receives the records, in the order of the file.
+	 * \exception std::runtime_error if the file can not be read or has an unknown format.
+	 */
+	static void load(const std::string& fileName, Records& records);
+
+	/*! \brief Tests if the records of the specified file have durations.
+	 *
+	 * Only the binary result format has durations: slowdowns can not be
+	 * checked against an xml file.
+	 * \exception std::runtime_error if the file can not be read.
+	 */
+	static bool hasDurations(const std::string& fileName);
+
+private:
+	static void loadXml(const std::string& content, Records& records);
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_RESULTFILE_H
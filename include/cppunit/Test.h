@@ -70,6 +70,44 @@ public:
    */
   virtual std::string getScopedName() const = 0;
 
+  /*! \brief Returns the prefix of the names of all the test cases of this test.
+   *
+   * Both the name and the scoped name of every test case contained in this
+   * test start with the prefix, which lets a test be skipped by name without
+   * building its children.
+   * \return Prefix shared by the names of the test cases, empty if unknown (default).
+   */
+  virtual std::string getTestNamePrefix() const;
+
+  /*! \brief Indicates if the child tests must be run within this test.
+   *
+   * A test that runs code around its child tests, such as TestSetUp, keeps
+   * them grouped: they can not be run apart from it, when the test cases are
+   * reordered for example.
+   * \return \c true if the child tests must be run by this test, \c false
+   *         if they can be run on their own (default).
+   */
+  virtual bool keepsChildTestsGrouped() const;
+
+  /*! \brief Returns the value of a property of the test.
+   *
+   * The fixture suites hold the properties added by CPPUNIT_TEST_SUITE_PROPERTY().
+   * \param key Key of the property.
+   * \return Value of the property, empty if the test does not have it (default).
+   */
+  virtual std::string getProperty(const std::string& key) const;
+
+  /*! \brief Returns a test that describes this test without making it.
+   *
+   * A test made only when needed, such as a LazyTestSuite, is described by a
+   * tree with the same test names and properties, built without creating the
+   * fixtures. It lets the tree be listed and filtered without making the
+   * test. The tests of a description must not be run.
+   * \return This test (default), a description owned by this test, or \c NULL
+   *         if the test can not be described without making it.
+   */
+  virtual Test* getDescription() const;
+
   /*! \brief Finds the test with the specified name and its parents test.
    * \param testName Name of the test to find.
    * \param testPath If the test is found, then all the tests traversed to access
@@ -114,14 +114,16 @@ class TestCaller : public TestCase
 public:
 	/*!
 	 * Constructor for TestCaller. This constructor builds a new Fixture
-	 * instance owned by the TestCaller.
+	 * instance owned by the TestCaller. The fixture is only built when the
+	 * test is set up, so tests that are not selected never build theirs.
 	 * \param name name of this TestCaller
 	 * \param test the method this TestCaller calls in runTest()
 	 */
 	TestCaller(std::string name, TestMethod test) :
 		TestCase(name), 
 		m_ownFixture(true),
-		m_fixture(new Fixture()),
+		m_fixture(NULL),
+		m_makeFixture(&TestCaller::makeFixture),
 		m_test(test)
 	{
 	}
@@ -139,6 +141,7 @@ public:
 		TestCase(name), 
 		m_ownFixture(false),
 		m_fixture(&fixture),
+		m_makeFixture(NULL),
 		m_test(test)
 	{
 	}
@@ -156,6 +159,7 @@ public:
 		TestCase(name), 
 		m_ownFixture(true),
 		m_fixture(fixture),
+		m_makeFixture(NULL),
 		m_test(test)
 	{
 	}
@@ -173,12 +177,15 @@ public:
 
 	void setUp()
 	{ 
+		if (!m_fixture)
+			m_fixture = m_makeFixture();
 		m_fixture->setUp (); 
 	}
 
 	void tearDown()
 	{ 
-		m_fixture->tearDown (); 
+		if (m_fixture)
+			m_fixture->tearDown (); 
 	}
 
 	std::string toString() const
@@ -191,25 +198,39 @@ public:
 		return getTestClassName() + "::" + TestCase::getName();
 	}
 
+	/*!
+	 * Returns the name of the fixture class, demangled the first time it is
+	 * requested for this fixture type.
+	 */
+	static const std::string& getTestClassName();
+
 private: 
 	TestCaller(const TestCaller &other); 
 	TestCaller &operator =(const TestCaller &other);
 
-	std::string getCallerClassName() const;
-	std::string getTestClassName() const;
+	static std::string getCallerClassName();
+	static std::string makeTestClassName();
+
+	// Only instantiated by the constructor that builds the fixture, so that
+	// abstract fixtures can still be given to the other constructors.
+	static Fixture *makeFixture()
+	{
+		return new Fixture();
+	}
 
 	private:
 	bool m_ownFixture;
 	Fixture *m_fixture;
+	Fixture *(*m_makeFixture)();
 	TestMethod m_test;
 };
 
 CPPUNIT_NS_END
 
 template <class Fixture>
-inline std::string CPPUNIT_NS::TestCaller<Fixture>::getCallerClassName() const
+inline std::string CPPUNIT_NS::TestCaller<Fixture>::getCallerClassName()
 {
-	const std::type_info& thisClass = typeid (*this);
+	const std::type_info& thisClass = typeid (TestCaller<Fixture>);
 
 #ifdef _WIN32
 	return thisClass.name();
@@ -224,7 +245,7 @@ inline std::string CPPUNIT_NS::TestCaller<Fixture>::getCallerClassName() const
 }
 
 template <class Fixture>
-inline std::string CPPUNIT_NS::TestCaller<Fixture>::getTestClassName() const
+inline std::string CPPUNIT_NS::TestCaller<Fixture>::makeTestClassName()
 {
 	// g++ gives us "TestCase<TestClassName>.testMethodName()"
     // vistual studio gives us "class TestCase<class TestClassName>.testMethodName()"
@@ -238,4 +259,12 @@ inline std::string CPPUNIT_NS::TestCaller<Fixture>::getTestClassName() const
 	return longName.substr(start + 1, end - start - 1);
 }
 
+template <class Fixture>
+inline const std::string& CPPUNIT_NS::TestCaller<Fixture>::getTestClassName()
+{
+	// Demangled once per fixture type.
+	static const std::string testClassName = makeTestClassName();
+	return testClassName;
+}
+
 #endif // CPPUNIT_TESTCALLER_H
@@ -0,0 +1,233 @@
+#ifndef CPPUNIT_TESTCASETABLE_H
+#define CPPUNIT_TESTCASETABLE_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/TestComposite.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief Compact suite of generated test cases.
+ * \ingroup CreatingTestSuite
+ *
+ * A TestSuite of TestCaller costs a heap object per test case, with its own
+ * name and fixture. A TestCaseTable stores its test cases in contiguous
+ * arrays instead: a 12 bytes descriptor per test case (name offset, method
+ * index and parameter), the names in a single pool, and the test methods in
+ * a table shared by all the test cases. The scoped names are not stored: they
+ * are the name of the table followed by the name of the test case.
+ *
+ * getChildTestAt() returns lightweight proxies, allocated by blocks the first
+ * time a test case is accessed and owned by the table, so the tools that walk
+ * the test tree keep working. countTestCases() does not create any proxy.
+ *
+ * A fixture is only instantiated while one of its test cases runs.
+ *
+ * \see TestCallerTable.
+ */
+class CPPUNIT_API TestCaseTable : public TestComposite
+{
+public:
+	/*! \brief Constructs an empty table.
+	 * \param name Name of the table, used as scope of its test cases.
+	 */
+	TestCaseTable(const std::string& name);
+
+	/// Destroys the table and its proxies.
+	virtual ~TestCaseTable();
+
+	/// Reserves memory for \a caseCount test cases and \a nameSize characters of names.
+	void reserve(int caseCount, size_t nameSize);
+
+	int countTestCases() const;
+
+	int getChildTestCount() const;
+
+	/// Returns the name of the test case at \a index.
+	std::string getCaseName(int index) const;
+
+	/// Returns the parameter of the test case at \a index.
+	unsigned int getCaseParameter(int index) const;
+
+protected:
+	Test* doGetChildTestAt(int index) const;
+
+	/*! \brief Adds a test case.
+	 * \param name Name of the test case, copied to the pool.
+	 * \param method Index of the test method, in the table of the subclass.
+	 * \param parameter Parameter passed to the test method.
+	 */
+	void addCase(const std::string& name, unsigned int method, unsigned int parameter);
+
+	/// Returns the method index of the test case at \a index.
+	unsigned int getCaseMethod(int index) const;
+
+	/// Instantiates the fixture of the test case at \a index and sets it up.
+	virtual void setUpCase(int index) = 0;
+
+	/// Runs the test method of the test case at \a index.
+	virtual void runCase(int index) = 0;
+
+	/// Tears down and destroys the fixture of the test case at \a index.
+	virtual void tearDownCase(int index) = 0;
+
+private:
+	class Case;
+	friend class Case;
+
+	struct Descriptor
+	{
+		unsigned int nameOffset;
+		unsigned int method;
+		unsigned int parameter;
+	};
+	typedef CppUnitVector<Descriptor> Descriptors;
+	typedef CppUnitVector<Case*> Proxies;
+
+	/// Prevents the use of the copy constructor.
+	TestCaseTable(const TestCaseTable& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const TestCaseTable& copy);
+
+private:
+	Descriptors     m_cases;
+	std::string     m_names;
+	mutable Proxies m_proxies;
+};
+
+
+/*! \brief TestCaseTable of the test methods of a fixture.
+ * \ingroup CreatingTestSuite
+ *
+ * Test methods either take no parameter, or the parameter of the test case:
+ * \code
+ * class SquareTest : public CppUnit::TestFixture
+ * {
+ * public:
+ *   void testSquare( unsigned int n );
+ * };
+ *
+ * CppUnit::TestCallerTable<SquareTest> *table =
+ *     new CppUnit::TestCallerTable<SquareTest>( "SquareTest" );
+ * for ( unsigned int n = 0; n < 1000000; ++n )
+ *   table->addTest( "testSquare" + toString( n ), &SquareTest::testSquare, n );
+ * \endcode
+ *
+ * A new fixture is created for each test case run, and destroyed after
+ * tearDown().
+ */
+template<class Fixture>
+class TestCallerTable : public TestCaseTable
+{
+public:
+	typedef void (Fixture::*TestMethod)();
+	typedef void (Fixture::*ParameterizedTestMethod)(unsigned int parameter);
+
+	TestCallerTable(const std::string& name)
+		: TestCaseTable(name)
+		, m_methods()
+		, m_fixture(NULL)
+	{
+	}
+
+	~TestCallerTable()
+	{
+		delete m_fixture;
+	}
+
+	/// Adds a test case that calls \a method.
+	void addTest(const std::string& name, TestMethod method)
+	{
+		addCase(name, addMethod(method, NULL), 0);
+	}
+
+	/// Adds a test case that calls \a method with \a parameter.
+	void addTest(const std::string& name, ParameterizedTestMethod method, unsigned int parameter)
+	{
+		addCase(name, addMethod(NULL, method), parameter);
+	}
+
+protected:
+	void setUpCase(int)
+	{
+		delete m_fixture;
+		m_fixture = NULL;
+		m_fixture = new Fixture();
+		m_fixture->setUp();
+	}
+
+	void runCase(int index)
+	{
+		const Method& method = m_methods[getCaseMethod(index)];
+		if(method.test)
+			(m_fixture->*method.test)();
+		else
+			(m_fixture->*method.parameterizedTest)(getCaseParameter(index));
+	}
+
+	void tearDownCase(int)
+	{
+		Fixture* fixture = m_fixture;
+		m_fixture = NULL;
+		if(! fixture)
+			return;
+
+		try
+		{
+			fixture->tearDown();
+		}
+		catch(...)
+		{
+			delete fixture;
+			throw;
+		}
+		delete fixture;
+	}
+
+private:
+	struct Method
+	{
+		TestMethod              test;
+		ParameterizedTestMethod parameterizedTest;
+	};
+
+	unsigned int addMethod(TestMethod test, ParameterizedTestMethod parameterizedTest)
+	{
+		// Test cases are usually added method by method: search from the last one.
+		for(unsigned int index = m_methods.size(); index > 0; --index)
+		{
+			const Method& method = m_methods[index - 1];
+			if(method.test == test && method.parameterizedTest == parameterizedTest)
+				return index - 1;
+		}
+
+		Method method;
+		method.test = test;
+		method.parameterizedTest = parameterizedTest;
+		m_methods.push_back(method);
+		return m_methods.size() - 1;
+	}
+
+private:
+	CppUnitVector<Method> m_methods;
+	Fixture*              m_fixture;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_TESTCASETABLE_H
@@ -0,0 +1,95 @@
+#ifndef CPPUNIT_TESTCHANGEFILTER_H
+#define CPPUNIT_TESTCHANGEFILTER_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/CoverageIndex.h>
+#include <cppunit/TestFilter.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <istream>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief TestFilter that selects the test cases affected by a change.
+ * \ingroup ExecutingTest
+ *
+ * A test case is selected if it covered, according to a CoverageIndex, one of
+ * the changed lines, or if it is not in the index, being newer than it. With an
+ * empty index, all the test cases are selected.
+ *
+ * The changed lines are given as ranges of lines of the indexed sources, that
+ * is of the sources before the change. A changed file matches an indexed file
+ * of the same path, or whose path ends with '/' followed by the changed path,
+ * so paths relative to the root of the sources match the absolute paths of
+ * the index.
+ *
+ * The selection is made on the names of the test cases, before their fixtures
+ * are built: a suite that knows the prefix of its test cases is only built if
+ * one of its indexed test cases is selected or covered a changed file, as new
+ * test cases may have been added to that file, or if none of its test cases
+ * are indexed.
+ *
+ * \see CoverageListener, TestResult::addFilter().
+ */
+class CPPUNIT_API TestChangeFilter : public TestFilter
+{
+public:
+	/*! \brief Constructs a filter without any change.
+	 * \param index Coverage of the test cases, copied by the filter.
+	 */
+	TestChangeFilter(const CoverageIndex& index);
+
+	/// Destructor.
+	virtual ~TestChangeFilter();
+
+	/*! \brief Adds changed lines.
+	 * \param fileName Path of the changed file.
+	 * \param first First changed line.
+	 * \param last Last changed line.
+	 */
+	void addChange(const std::string& fileName, unsigned int first, unsigned int last);
+
+	/*! \brief Adds the changes of a unified diff, such as the output of <tt>git diff</tt>.
+	 *
+	 * The removed lines of each hunk are changed lines. A hunk that only adds
+	 * lines changes the lines around the insertion.
+	 */
+	void addDiff(std::istream& diff);
+
+	/// Accepts the test cases that covered a changed line, or that are not indexed.
+	bool accept(Test* test) const;
+
+	/// Rejects a prefix whose indexed test cases are neither selected nor covered a changed file.
+	bool acceptPrefix(const std::string& prefix) const;
+
+private:
+	static bool matchesFile(const std::string& indexedName, const std::string& fileName);
+
+	/// Prevents the use of the copy constructor.
+	TestChangeFilter(const TestChangeFilter& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const TestChangeFilter& copy);
+
+private:
+	CoverageIndex       m_index;
+	CppUnitVector<bool> m_selected;
+	CppUnitVector<bool> m_changedFile;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_TESTCHANGEFILTER_H
@@ -20,6 +20,11 @@ class Test;
  *
  * TestFailure assumes lifetime control for any exception
  * passed to it.
+ *
+ * Failures reported by TestResult are created by create() and are reference
+ * counted: listeners that keep a failure call share() instead of clone(),
+ * and release() it when done. A shared failure must not be modified: unshare()
+ * returns a failure that can be.
  */
 class CPPUNIT_API TestFailure 
 {
@@ -40,12 +45,55 @@ public:
 
   virtual std::string failedTestName() const;
 
+  /*! \brief Gets the output written by the test while it was captured.
+   * \return Captured output, empty if the output was not captured.
+   * \see TestResult::setOutputCapture().
+   */
+  virtual std::string capturedOutput() const;
+
+  /// Sets the output written by the test.
+  virtual void setCapturedOutput( const std::string &output );
+
   virtual TestFailure *clone() const;
 
+  /*! \brief Creates a reference counted failure.
+   *
+   * The returned failure holds one reference, released by release().
+   */
+  static TestFailure *create( Test *failedTest,
+                              Exception *thrownException,
+                              bool isError );
+
+  /*! \brief Returns a new reference to this failure.
+   *
+   * If the failure is reference counted, the same failure is returned and
+   * its exception is not copied. Otherwise a reference counted clone() is
+   * returned. Either way, the result must be released by release().
+   */
+  TestFailure *share() const;
+
+  /*! \brief Releases a reference returned by create() or share().
+   *
+   * The failure is deleted when its last reference is released.
+   */
+  void release() const;
+
+  /*! \brief Exchanges a reference for a failure that is not shared.
+   *
+   * If the reference is the last one, or the failure is not reference counted,
+   * the failure itself is returned. Otherwise the reference is released and a
+   * reference counted clone() is returned. Either way, the result may be
+   * modified and must be released by release().
+   */
+  TestFailure *unshare() const;
+
 protected:
   Test *m_failedTest;
   Exception *m_thrownException;
   bool m_isError;
+  std::string m_capturedOutput;
+  /// Number of references, 0 if the failure is not reference counted.
+  mutable volatile long m_referenceCount;
 
 private: 
   TestFailure( const TestFailure &other ); 
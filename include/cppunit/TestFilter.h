@@ -0,0 +1,51 @@
+#ifndef CPPUNIT_TESTFILTER_H
+#define CPPUNIT_TESTFILTER_H
+
+#include <cppunit/Portability.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+class Test;
+
+
+/*! \brief Selects the test cases that are run.
+ * \ingroup ExecutingTest
+ *
+ * Filters are registered to the TestResult used to run the tests. Before a
+ * test case is run, TestResult::shouldRun() asks each filter whether the test
+ * case is accepted. A test case is only run if all the filters accept it, and
+ * a composite is skipped entirely (including its suite events) when none of
+ * its test cases are accepted.
+ *
+ * Filters are not owned by the TestResult.
+ *
+ * \see TestResult::addFilter(), TestResult::shouldRun().
+ */
+class CPPUNIT_API TestFilter
+{
+public:
+	virtual ~TestFilter() {}
+
+	/*! \brief Tests if the specified test case should be run.
+	 * \param test Test case (a test without child test). Never \c NULL.
+	 * \return \c true if the test case should be run, \c false otherwise.
+	 */
+	virtual bool accept(Test* test) const = 0;
+
+	/*! \brief Tests if a test case named with the specified prefix may be accepted.
+	 *
+	 * Called for the tests that know the prefix of the names of their test
+	 * cases (see Test::getTestNamePrefix()), before their children are built.
+	 * \param prefix Prefix of the name and scoped name of the test cases.
+	 * \return \c false if no such test case can be accepted, \c true otherwise (default).
+	 */
+	virtual bool acceptPrefix(const std::string& /*prefix*/) const { return true; }
+};
+
+
+CPPUNIT_NS_END
+
+#endif // CPPUNIT_TESTFILTER_H
@@ -0,0 +1,163 @@
+#ifndef CPPUNIT_TESTHISTORY_H
+#define CPPUNIT_TESTHISTORY_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/TestRecord.h>
+#include <cppunit/portability/CppUnitMap.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+class MappedFile;
+
+
+/*! \brief Append-only store of the results of successive test runs.
+ * \ingroup WritingTestResult
+ *
+ * The store is a directory holding one file per column. Row \e i of the
+ * history is made of the \e i-th value of each column:
+ *
+ * - \c run.col: id of the run (32 bits), runs are numbered from 0.
+ * - \c test.col: id of the test (64 bits, see TestJournal::testId()).
+ * - \c status.col: TestRecord::Status of the test (8 bits).
+ * - \c duration.col: duration of the test in microseconds (64 bits).
+ * - \c cputime.col: CPU time used by the test in microseconds (64 bits).
+ * - \c memory.col: peak resident memory of the process in kilobytes (64 bits).
+ *
+ * Values are stored in the byte order of the machine. The names of the tests
+ * are kept in \c names.txt (one "id name" line per test) and the start time of
+ * each run in \c runs.txt.
+ *
+ * A run is started with addRun() and its rows are appended with addRows(),
+ * preferably in large batches. Readers map the columns with
+ * load() and scan them without parsing: a query over a single column only
+ * touches the pages of that column. If a run was interrupted while its
+ * columns were appended, the rows that are not complete in every column are
+ * ignored, and dropped by the next addRows().
+ *
+ * \see HistoryListener.
+ */
+class CPPUNIT_API TestHistory
+{
+public:
+	/// Result of a test in a run.
+	struct Row
+	{
+		unsigned long long testId;
+		TestRecord::Status status;
+		unsigned long long duration;
+		unsigned long long cpuTime;
+		unsigned long long peakMemory;
+	};
+	typedef CppUnitVector<Row> Rows;
+
+	/*! \brief Opens the store.
+	 * \param directory Directory of the store.
+	 * \param writable If \c true, runs can be added and the directory is
+	 *                 created if it does not exist. Otherwise the store
+	 *                 must exist, and is only read.
+	 * \exception std::runtime_error if the directory can not be created, or
+	 *            if a store opened for reading does not exist.
+	 */
+	TestHistory(const std::string& directory, bool writable = false);
+
+	/// Unmaps the columns.
+	virtual ~TestHistory();
+
+	/*! \brief Registers the name of a test.
+	 *
+	 * The names of new tests are written with the next run.
+	 * \return Id of the test.
+	 */
+	unsigned long long addTest(const std::string& name);
+
+	/*! \brief Starts a new run.
+	 * \return Id of the run.
+	 * \exception std::runtime_error if the run can not be written.
+	 */
+	unsigned int addRun();
+
+	/*! \brief Appends rows to the specified run.
+	 * \exception std::runtime_error if the columns can not be written.
+	 */
+	void addRows(unsigned int runId, const Rows& rows);
+
+	/*! \brief Maps the columns for reading.
+	 * \exception std::runtime_error if a column is missing or can not be mapped.
+	 */
+	void load();
+
+	/// Returns the number of runs.
+	unsigned int runCount() const;
+
+	/// Returns the number of complete rows mapped by load().
+	size_t rowCount() const;
+
+	const unsigned int* runIds() const;
+	const unsigned long long* testIds() const;
+	const unsigned char* statuses() const;
+	const unsigned long long* durations() const;
+	const unsigned long long* cpuTimes() const;
+	const unsigned long long* peakMemories() const;
+
+	/// Returns the name of the specified test, its id if the name is unknown.
+	std::string testName(unsigned long long testId) const;
+
+private:
+	enum Column
+	{
+		runColumn = 0,
+		testColumn,
+		statusColumn,
+		durationColumn,
+		cpuTimeColumn,
+		memoryColumn,
+		columnCount
+	};
+
+	void readNames();
+	void readRuns();
+	void appendColumn(Column column, const void* data, size_t size);
+	void truncateColumns();
+	void unload();
+	std::string path(const std::string& fileName) const;
+	const char* columnData(Column column) const;
+
+	static const char* columnFileNames[columnCount];
+	static const size_t columnWidths[columnCount];
+
+	/// Prevents the use of the copy constructor.
+	TestHistory(const TestHistory& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const TestHistory& copy);
+
+private:
+	typedef CppUnitMap<unsigned long long, std::string, std::less<unsigned long long> > TestNames;
+
+	std::string  m_directory;
+	bool         m_writable;
+	TestNames    m_names;
+	std::string  m_newNames;
+	unsigned int m_runCount;
+	MappedFile*  m_columns[columnCount];
+	size_t       m_rowCount;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_TESTHISTORY_H
@@ -0,0 +1,117 @@
+#ifndef CPPUNIT_TESTJOURNAL_H
+#define CPPUNIT_TESTJOURNAL_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/TestRecord.h>
+#include <cppunit/portability/CppUnitDeque.h>
+#include <cppunit/portability/CppUnitMap.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+class MappedFile;
+class TestFailure;
+
+
+/*! \brief Crash-safe record of the tests run.
+ * \ingroup WritingTestResult
+ *
+ * The journal is a memory mapped file. Each test appends a fixed-size record
+ * (test id, status, duration and offset of the failure) followed by the test
+ * name. The record is written when the test starts and updated in place when
+ * it ends, so a test that was running when the process died can be
+ * identified. The failure of a test is appended as a separate entry.
+ *
+ * An entry becomes visible to readers only once its kind field is written,
+ * which is done last. Since the mapping is shared with the system page cache,
+ * records survive the process being killed without a fsync per test.
+ *
+ * \see JournalListener.
+ */
+class CPPUNIT_API TestJournal
+{
+public:
+	/// Status of a test in the journal.
+	typedef TestRecord::Status Status;
+
+	/// A test read from the journal.
+	typedef TestRecord Record;
+	typedef CppUnitDeque<Record> Records;
+
+	/*! \brief Opens the journal.
+	 * \param fileName Name of the journal file. Created if it does not exist.
+	 * \param append If \c true, the records of the existing journal are read
+	 *               and new records are appended to it. Otherwise the journal
+	 *               is emptied.
+	 * \exception std::runtime_error if the file can not be mapped, or is not a journal.
+	 */
+	TestJournal(const std::string& fileName, bool append = false);
+
+	/// Flushes and closes the journal.
+	virtual ~TestJournal();
+
+	/*! \brief Returns the records found when the journal was opened.
+	 *
+	 * If a test appears several times, only its last record is kept.
+	 */
+	const Records& records() const;
+
+	/*! \brief Finds the record of the specified test.
+	 * \return Record found when the journal was opened, \c NULL if none.
+	 */
+	const Record* find(const std::string& name) const;
+
+	/// Appends a record for a test that is starting.
+	void startTest(const std::string& name);
+
+	/// Appends the failure of the test that was started last.
+	void addFailure(const TestFailure& failure);
+
+	/// Ends the test started last.
+	void endTest(Status status, unsigned long long duration);
+
+	/// Schedules the journal to be written to disk, without waiting.
+	void flush();
+
+	/// Returns the 64 bits id of a test: a FNV-1a hash of its name.
+	static unsigned long long testId(const std::string& name);
+
+private:
+	bool read();
+	void readFailure(unsigned long long offset, Record& record) const;
+	void initialize();
+	char* allocate(unsigned int size);
+	static void commit(char* entry, unsigned int kind);
+
+	/// Prevents the use of the copy constructor.
+	TestJournal(const TestJournal& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const TestJournal& copy);
+
+private:
+	typedef CppUnitMap<std::string, unsigned int, std::less<std::string> > RecordIndexes;
+
+	MappedFile*        m_file;
+	Records            m_records;
+	RecordIndexes      m_indexes;
+	size_t             m_end;
+	size_t             m_current;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_TESTJOURNAL_H
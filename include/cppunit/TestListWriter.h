@@ -0,0 +1,112 @@
+#ifndef CPPUNIT_TESTLISTWRITER_H
+#define CPPUNIT_TESTLISTWRITER_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/portability/CppUnitVector.h>
+#include <cppunit/portability/Stream.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+class Test;
+class TestResult;
+
+
+/*! \brief Writes the list of the tests of a test tree, without running them.
+ * \ingroup WritingTestResult
+ *
+ * The tree is walked once when the writer is constructed. Only the test cases
+ * selected by the filters of the TestResult are listed, and the suites without
+ * a selected test case are omitted.
+ *
+ * The suites made only when needed, such as the LazyTestSuite of the suites
+ * registered with CPPUNIT_TEST_SUITE_REGISTRATION(), are not made: making
+ * them would create the fixtures of CPPUNIT_TEST(). Their test cases are
+ * listed from their description (see Test::getDescription()), which has the
+ * names and properties of the suite but no fixture. A suite without a
+ * description is listed by name only, as a lazy suite, unless there are
+ * filters, and the count of its parents is then a lower bound.
+ *
+ * write() prints one line per test, indented by depth. Suites are followed by
+ * their count of selected test cases, test cases are printed with their scoped
+ * name:
+ * \code
+ * All Tests: 9+ tests
+ *   FooTest: 8 tests
+ *     FooTest::testOk
+ *   ParserTest: lazy suite
+ * \endcode
+ *
+ * writeJson() prints the same tree as a JSON object. Each test has a \c name
+ * and a \c scopedName. Suites have a \c testCount and their \c tests, or
+ * \c isLazy if they are listed by name only. The suites whose count is a
+ * lower bound have \c isComplete set to \c false.
+ *
+ * \see TestResult::addFilter().
+ */
+class CPPUNIT_API TestListWriter
+{
+public:
+	/*! \brief Walks the test tree.
+	 * \param root Root of the tree.
+	 * \param controller If not \c NULL, its filters select the test cases listed.
+	 */
+	TestListWriter(Test* root, TestResult* controller = NULL);
+
+	/// Destructor.
+	virtual ~TestListWriter();
+
+	/// Returns the number of test cases listed.
+	int testCount() const;
+
+	/// Indicates if all the test cases are listed, and not only counted in part.
+	bool isComplete() const;
+
+	/// Writes the list as indented text.
+	void write(OStream& stream) const;
+
+	/// Writes the list as JSON.
+	void writeJson(OStream& stream) const;
+
+private:
+	struct Entry
+	{
+		Test* test;
+		int   depth;
+		int   testCount;
+		bool  isSuite;
+		bool  isLazy;
+		bool  isComplete;
+	};
+	typedef CppUnitVector<Entry> Entries;
+
+	int add(Test* test, int depth, TestResult* controller);
+	unsigned int writeJson(unsigned int index, std::string& text) const;
+	static void appendJsonString(std::string& text, const std::string& value);
+
+	/// Prevents the use of the copy constructor.
+	TestListWriter(const TestListWriter& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const TestListWriter& copy);
+
+private:
+	Entries m_entries;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_TESTLISTWRITER_H
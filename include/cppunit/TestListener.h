@@ -102,7 +102,7 @@ public:
   /*! \brief Called when a failure occurs while running a test.
    * \see TestFailure.
    * \warning \a failure is a temporary object that is destroyed after the 
-   *          method call. Use TestFailure::clone() to create a duplicate.
+   *          method call. Use TestFailure::share() to keep a reference.
    */
   virtual void addFailure( const TestFailure & /*failure*/ ) {}
 
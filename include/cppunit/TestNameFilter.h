@@ -0,0 +1,114 @@
+#ifndef CPPUNIT_TESTNAMEFILTER_H
+#define CPPUNIT_TESTNAMEFILTER_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/TestFilter.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+class RegularExpression;
+
+
+/*! \brief TestFilter that selects the test cases by name.
+ * \ingroup ExecutingTest
+ *
+ * Patterns are separated by a single ':' (a "::" is part of the pattern).
+ * A pattern is either a glob, where '*' matches any sequence of characters
+ * and '?' matches one character, or a POSIX extended regular expression
+ * enclosed in '/'. Patterns must match the whole name, or the whole scoped
+ * name, of a test case.
+ *
+ * Patterns following a '-' are negative:
+ * \code
+ * Foo::*:/Bar::test(Add|Sub)/:-Foo::testSlow*
+ * \endcode
+ * selects the tests of Foo, and the tests testAdd and testSub of Bar, except the
+ * tests of Foo whose name begins with testSlow. If there are only negative
+ * patterns, all the other tests are selected.
+ *
+ * The patterns are compiled when they are added. Registered to the TestResult,
+ * the filter selects all the matching tests in a single run, and skips the
+ * suites without any matching test.
+ *
+ * \see TestResult::addFilter().
+ */
+class CPPUNIT_API TestNameFilter : public TestFilter
+{
+public:
+	/*! \brief Constructs a filter.
+	 * \param patterns Patterns to add. If empty, all the test cases are accepted.
+	 * \exception std::runtime_error if a regular expression is invalid.
+	 */
+	TestNameFilter(const std::string& patterns = "");
+
+	/// Destructor.
+	virtual ~TestNameFilter();
+
+	/*! \brief Adds patterns to the filter.
+	 *
+	 * The '-' of \a patterns only applies to the patterns added by this call.
+	 *
+	 * \exception std::runtime_error if a regular expression is invalid.
+	 */
+	void addPatterns(const std::string& patterns);
+
+	/*! \brief Sets the scope of the tests.
+	 *
+	 * The patterns then also match the scoped name of the test cases prefixed
+	 * by \a scope, such as "libfoo::FooTest::testBar" for the scope "libfoo::".
+	 */
+	void setScope(const std::string& scope);
+
+	/// Tests if \a name is matched by the positive patterns and none of the negative ones.
+	bool matches(const std::string& name) const;
+
+	/// Accepts the test cases whose name, scoped name or name in the scope matches().
+	bool accept(Test* test) const;
+
+	/// Rejects a prefix that no positive glob pattern can match.
+	bool acceptPrefix(const std::string& prefix) const;
+
+private:
+	struct Pattern
+	{
+		std::string        glob;
+		RegularExpression* expression;
+	};
+	typedef CppUnitVector<Pattern> Patterns;
+
+	void clear();
+	bool globAcceptsPrefix(const std::string& prefix) const;
+
+	static bool matchesAny(const Patterns& patterns, const std::string& name);
+	static bool matchesGlob(const std::string& glob, const std::string& name);
+
+	/// Prevents the use of the copy constructor.
+	TestNameFilter(const TestNameFilter& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const TestNameFilter& copy);
+
+private:
+	Patterns m_positive;
+	Patterns m_negative;
+	std::string m_scope;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_TESTNAMEFILTER_H
@@ -0,0 +1,169 @@
+#ifndef CPPUNIT_TESTORDER_H
+#define CPPUNIT_TESTORDER_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/TestListener.h>
+#include <cppunit/portability/CppUnitMap.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <cppunit/portability/Stream.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+class TestResult;
+
+
+/*! \brief Runs the test cases most likely to fail first.
+ * \ingroup ExecutingTest
+ *
+ * The order is driven by a record of the recent outcomes of the test cases,
+ * kept up to date by registering the TestOrder as a TestListener and writing
+ * it once the tests are run. The record also counts the changes of the build
+ * of the tests (see TestResultCache::binaryId()), to tell the new test cases.
+ *
+ * - failedFirst runs the test cases whose last outcome was a failure first,
+ *   the most recent failures first.
+ * - likelyFail weighs the failures of the last 32 runs of each test case, the
+ *   most recent ones counting most, and adds a bonus to the test cases added
+ *   by the last builds, or not recorded yet.
+ *
+ * Other test cases keep their order. The test cases are reordered across the
+ * suites, except for the child tests of a test that keeps them grouped, such
+ * as a TestSetUp: they are run together, ordered as their most likely failure.
+ * Combined with TestResult::stopOnFailure(), the run stops at the first failure,
+ * found early.
+ *
+ * The record also holds the last duration of each test case. With a time
+ * budget (see setTimeBudget()), only the test cases that fit in the budget are
+ * run: they are picked greedily, the highest chance of failure by second of
+ * run first, as for a knapsack problem. The chance of failure is estimated as
+ * for likelyFail. The other test cases are deferred, see writeDeferred().
+ * The test cases not recorded yet are expected to last the average recorded
+ * duration. While the record holds no test case, the durations are unknown:
+ * the budget is not applied and all the test cases are run, which
+ * writeDeferred() reports.
+ *
+ * \see Test::keepsChildTestsGrouped().
+ */
+class CPPUNIT_API TestOrder : public TestListener
+{
+public:
+	/// Orders of the test cases.
+	enum Mode
+	{
+		failedFirst,
+		likelyFail
+	};
+
+	/*! \brief Constructs a TestOrder object, reading the record.
+	 * \param fileName Path of the record, which may not exist yet.
+	 * \param binaryId Identifier of the build of the tests.
+	 * \param mode Order of the test cases.
+	 */
+	TestOrder(const std::string& fileName, const std::string& binaryId, Mode mode);
+
+	/// Destructor.
+	virtual ~TestOrder();
+
+	/*! \brief Returns a test that runs the test cases of a test in order.
+	 *
+	 * The returned test is owned by the TestOrder and refers to the test cases
+	 * of \a test, which must outlive it. With a time budget, the test cases
+	 * that do not fit in the remaining budget are deferred.
+	 * \param test Test to order.
+	 * \param controller Used to skip the suites rejected by their name before
+	 *                   they are made, may be \c NULL.
+	 */
+	Test* order(Test* test, TestResult* controller = NULL);
+
+	/// Returns the score of a test case: the higher, the sooner it runs.
+	double score(const std::string& testName) const;
+
+	/*! \brief Sets the time budget of the following calls to order().
+	 * \param microseconds Time budget, shared by the calls to order(); 0 for none (default).
+	 */
+	void setTimeBudget(unsigned long long microseconds);
+
+	/// Returns the names of the test cases deferred for lack of time.
+	const CppUnitVector<std::string>& deferredTests() const;
+
+	/*! \brief Reports the test cases deferred for lack of time, if any, or
+	 *         that the time budget could not be applied.
+	 */
+	void writeDeferred(OStream& stream) const;
+
+	void startTest(Test* test);
+	void addFailure(const TestFailure& failure);
+	void endTest(Test* test);
+
+	/*! \brief Writes the record, with the outcomes of the test cases run.
+	 * \exception std::runtime_error if the record can not be written.
+	 */
+	void write() const;
+
+private:
+	struct Entry
+	{
+		unsigned int outcomes;        ///< One bit by run, the last run first; 1 for a failure.
+		unsigned int lastFailedRun;   ///< Number of the last run that failed, 0 if none.
+		unsigned int firstChange;     ///< Number of the build change the test was first run at.
+		unsigned long long duration;  ///< Duration of the last run, in microseconds.
+	};
+
+	struct Unit
+	{
+		Test* test;
+		unsigned int index;
+		double score;
+		double value;
+		unsigned long long cost;
+	};
+
+	typedef CppUnitMap<std::string, Entry, std::less<std::string> > Entries;
+	typedef CppUnitVector<Unit> Units;
+
+	void addUnits(Test* test, TestResult* controller, Units& units) const;
+	void selectUnits(Units& units);
+	void addDeferred(Test* test);
+	double failureScore(const std::string& testName) const;
+	double maxScore(Test* test, bool isFailureScore) const;
+	unsigned long long cost(Test* test, unsigned long long unknownDuration) const;
+
+	/// Prevents the use of the copy constructor.
+	TestOrder(const TestOrder& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const TestOrder& copy);
+
+private:
+	std::string                 m_fileName;
+	std::string                 m_binaryId;
+	Mode                        m_mode;
+	unsigned int                m_run;
+	unsigned int                m_change;
+	Entries                     m_entries;
+	CppUnitVector<Test*>        m_orderedTests;
+	bool                        m_hasTimeBudget;
+	bool                        m_isTimeBudgetIgnored;
+	unsigned long long          m_timeBudget;
+	CppUnitVector<std::string>  m_deferred;
+	bool                        m_hasFailed;
+	unsigned long long          m_startTime;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_TESTORDER_H
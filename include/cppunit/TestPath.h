@@ -63,7 +63,8 @@ public:
    * of the path must be the name of \a searchRoot. Otherwise, \a pathAsString is a 
    * relative path, and the first test found using Test::findTest() matching the first
    * test name is used as root. An empty string resolve to a path containing 
-   * \a searchRoot.
+   * \a searchRoot. A relative path made of a single scoped name, such as
+   * "Fixture::test", is first searched as a whole with Test::findTestPath().
    *
    * The resolved path is always valid.
    *
@@ -185,6 +186,17 @@ protected:
   bool splitPathString( const std::string &pathAsString,
                         PathTestNames &testNames );
 
+  /*! \brief Resolves a relative path made of a single scoped name.
+   * \param searchRoot Test the scoped name is searched in.
+   * \param scopedName Scoped name of the test, such as "Fixture::test".
+   * \param testCount Number of name components of \a scopedName.
+   * \return \c true if the test is found, and its last \a testCount tests
+   *         added to this path, \c false otherwise.
+   */
+  bool findScopedName( Test *searchRoot,
+                       const std::string &scopedName,
+                       int testCount );
+
   /*! \brief Finds the actual root of a path string and get the path string name components.
    * \param searchRoot Test used as root if the path string is absolute, or to search
    *                   the root test if the path string is relative.
@@ -0,0 +1,77 @@
+#ifndef CPPUNIT_TESTRECORD_H
+#define CPPUNIT_TESTRECORD_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/portability/CppUnitVector.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+class Exception;
+class TestFailure;
+
+
+/*! \brief Result of a test case, detached from the test that produced it.
+ * \ingroup BrowsingCollectedTestResult
+ *
+ * Records are what result files (TestJournal, binary results) store: the
+ * scoped name of the test, its status and duration, and the first failure
+ * reported for it.
+ */
+struct CPPUNIT_API TestRecord
+{
+	/// Status of a test.
+	enum Status
+	{
+		/// Test started but did not end.
+		running = 0,
+		success,
+		failure,
+		error
+	};
+
+	TestRecord();
+
+	/*! \brief Sets the status and failure fields from the specified failure.
+	 *
+	 * Only the first failure of a test is kept: the record is not changed if
+	 * it is already a failure or an error.
+	 */
+	void setFailure(const TestFailure& failure);
+
+	/*! \brief Builds the exception of the recorded failure.
+	 * \return New exception, owned by the caller.
+	 */
+	Exception* makeException() const;
+
+	/// Indicates if the test failed or ended with an error.
+	bool isFailure() const;
+
+	std::string                name;
+	Status                     status;
+	/// Duration in microseconds.
+	unsigned long long         duration;
+	std::string                fileName;
+	/// Line of the failure, -1 if unknown.
+	int                        lineNumber;
+	std::string                shortDescription;
+	CppUnitVector<std::string> details;
+	std::string                capturedOutput;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_TESTRECORD_H
@@ -17,10 +17,12 @@ CPPUNIT_NS_BEGIN
 
 class Exception;
 class Functor;
+class OutputCapture;
 class Protector;
 class ProtectorChain;
 class Test;
 class TestFailure;
+class TestFilter;
 class TestListener;
 
 
@@ -61,6 +63,36 @@ public:
 
   virtual void removeListener( TestListener *listener );
 
+  /*! \brief Adds a filter used to select the test cases to run.
+   * \param filter Filter to add. Not owned by the TestResult.
+   */
+  virtual void addFilter( TestFilter *filter );
+
+  /// Removes the specified filter.
+  virtual void removeFilter( TestFilter *filter );
+
+  /// Indicates if a filter was added, that may reject some test cases.
+  virtual bool hasFilters() const;
+
+  /*! \brief Returns whether the specified test should be run.
+   *
+   * A test case is run if all the registered filters accept it. A test with
+   * children is run if at least one of its test cases should be run.
+   */
+  virtual bool shouldRun( Test *test ) const;
+
+  /*! \brief Captures the output of each test case.
+   *
+   * While a test case runs, its standard output and error are redirected to
+   * \a capture. Failures of the test case are reported to the listeners when
+   * it ends, with the captured output attached (see TestFailure::capturedOutput()).
+   * The output of successful tests is discarded.
+   *
+   * \param capture Capture to use, \c NULL to disable capture. Not owned by
+   *                the TestResult.
+   */
+  virtual void setOutputCapture( OutputCapture *capture );
+
   /// Resets the stop flag.
   virtual void reset();
   
@@ -70,6 +102,15 @@ public:
   /// Returns whether testing should be stopped
   virtual bool shouldStop() const;
 
+  /*! \brief Stops testing at the first failure.
+   *
+   * The test case that fails runs to its end, then the remaining tests are
+   * not run. The stop flag is set by the first failure reported to the
+   * listeners after this call.
+   * \param doStop \c true to stop at the first failure, \c false to run all the tests.
+   */
+  virtual void stopOnFailure( bool doStop = true );
+
   /// Informs TestListener that a test will be started.
   virtual void startTest( Test *test );
 
@@ -129,14 +170,26 @@ protected:
    */
   void addFailure( const TestFailure &failure );
 
+  /// Informs TestListener of a failure (the caller holds the lock).
+  void reportFailure( const TestFailure &failure );
+
   virtual void startTestRun( Test *test );
   virtual void endTestRun( Test *test );
+
+  /// Tests \a test against the filters (the caller holds the lock).
+  bool isSelected( Test *test ) const;
   
 protected:
   typedef CppUnitDeque<TestListener *> TestListeners;
   TestListeners m_listeners;
+  typedef CppUnitDeque<TestFilter *> TestFilters;
+  TestFilters m_filters;
+  typedef CppUnitDeque<TestFailure *> TestFailures;
+  TestFailures m_capturedFailures;
+  OutputCapture *m_capture;
   ProtectorChain *m_protectorChain;
   bool m_stop;
+  bool m_stopOnFailure;
 
 private: 
   TestResult( const TestResult &other );
@@ -0,0 +1,145 @@
+#ifndef CPPUNIT_TESTRESULTCACHE_H
+#define CPPUNIT_TESTRESULTCACHE_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/TestFilter.h>
+#include <cppunit/TestListener.h>
+#include <cppunit/portability/CppUnitMap.h>
+#include <cppunit/portability/CppUnitSet.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+class TestResultCollector;
+
+
+/*! \brief Skips the test cases whose passing result is cached.
+ * \ingroup ExecutingTest
+ *
+ * A passing result is cached under a key hashed from the identifier of the
+ * build of the tests (see binaryId()), the scoped name of the test case and
+ * the content of its declared input files. A test case is skipped while the
+ * same key is in the cache: failures are never cached, and a rebuild or a
+ * change of an input file makes a new key, so such tests run again.
+ *
+ * The input files of the test cases of a fixture suite are declared by the
+ * \c InputFiles suite property, a list of paths separated by ';'. The cache
+ * reads the property from the suite, found in the tree of the tests by the
+ * name of the test case. Relative paths are resolved against the working
+ * directory when the cache is constructed, and the resolved path is part of
+ * the key: running the tests from another directory makes new keys.
+ * \code
+ * CPPUNIT_TEST_SUITE( ParserTest );
+ * CPPUNIT_TEST_SUITE_PROPERTY( "InputFiles", "data/grammar.txt;data/samples.txt" );
+ * CPPUNIT_TEST( testParse );
+ * CPPUNIT_TEST_SUITE_END();
+ * \endcode
+ *
+ * Register the cache as a TestListener to record the passing results, and as
+ * a TestFilter to skip the cached test cases. At the end of each test run, the
+ * skipped test cases are replayed into the TestResultCollector, marked as cached.
+ *
+ * The cache is the file \c results.txt of the cache directory. Results are
+ * appended to it as the test cases pass, so that concurrent runs may share
+ * the directory. At the end of each test run, the file is rewritten with only
+ * the results of the current build: use a cache directory per test binary.
+ * Delete the directory to empty the cache.
+ */
+class CPPUNIT_API TestResultCache : public TestListener, public TestFilter
+{
+public:
+	/*! \brief Constructs a TestResultCache object.
+	 * \param directory Directory of the cache, created if needed.
+	 * \param binaryId Identifier of the build of the tests, see binaryId().
+	 * \param tests Tree of the tests, where the suites declare their input
+	 *              files; may be \c NULL if they do not declare any.
+	 * \param collector Collector to replay the skipped test cases into, may be \c NULL.
+	 * \exception std::runtime_error if the directory can not be created.
+	 */
+	TestResultCache(const std::string& directory, const std::string& binaryId, Test* tests, TestResultCollector* collector = NULL);
+
+	/// Destructor.
+	virtual ~TestResultCache();
+
+	/// Accepts the test cases without a cached passing result.
+	bool accept(Test* test) const;
+
+	/*! \brief Adds the test cases skipped since the last replay to a collector.
+	 *
+	 * They are added with their cached duration, marked as cached.
+	 */
+	void replay(TestResultCollector* collector);
+
+	void startTest(Test* test);
+	void addFailure(const TestFailure& failure);
+	void endTest(Test* test);
+
+	/*! \brief Replays the skipped test cases, then rewrites the cache file
+	 *         without the results of other builds.
+	 */
+	void endTestRun(Test* test, TestResult* eventManager);
+
+	/*! \brief Returns the identifier of the build of a binary.
+	 *
+	 * It is the GNU build-id of the binary, if it has one, or a hash of its content.
+	 * \return An empty string if the binary can not be read.
+	 */
+	static std::string binaryId(const std::string& fileName);
+
+private:
+	struct Entry
+	{
+		unsigned long long duration;  ///< Duration of the passing run, in microseconds.
+		std::string name;             ///< Scoped name of the test case.
+	};
+
+	typedef CppUnitMap<std::string, Entry, std::less<std::string> > Entries;
+	typedef CppUnitMap<std::string, std::string, std::less<std::string> > Hashes;
+	typedef CppUnitMap<std::string, CppUnitVector<std::string>, std::less<std::string> > InputFiles;
+	typedef CppUnitVector<std::pair<Test*, unsigned long long> > Skipped;
+
+	void read();
+	void write() const;
+	std::string keyOf(Test* test) const;
+	const CppUnitVector<std::string>& inputFilesOf(const std::string& suiteName) const;
+	std::string hashFile(const std::string& fileName) const;
+
+	/// Prevents the use of the copy constructor.
+	TestResultCache(const TestResultCache& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const TestResultCache& copy);
+
+private:
+	std::string                 m_fileName;
+	std::string                 m_binaryId;
+	Test*                       m_tests;
+	std::string                 m_workingDirectory;
+	TestResultCollector*        m_collector;
+	Entries                     m_entries;
+	mutable InputFiles          m_inputFiles;
+	mutable Hashes              m_fileHashes;
+	mutable Skipped             m_skipped;
+	mutable CppUnitSet<Test*>   m_skippedTests;
+	std::string                 m_key;
+	bool                        m_hasFailed;
+	unsigned long long          m_startTime;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_TESTRESULTCACHE_H
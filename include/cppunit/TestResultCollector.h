@@ -8,15 +8,16 @@
 #pragma warning( disable: 4251 4660 )  // X needs to have dll-interface to be used by clients of class Z
 #endif
 
+#include <cppunit/TestRecord.h>
 #include <cppunit/TestSuccessListener.h>
-#include <cppunit/portability/CppUnitDeque.h>
+#include <cppunit/portability/CppUnitVector.h>
 
 
 CPPUNIT_NS_BEGIN
 
 #if CPPUNIT_NEED_DLL_DECL
-//  template class CPPUNIT_API std::deque<TestFailure *>;
-//  template class CPPUNIT_API std::deque<Test *>;
+//  template class CPPUNIT_API std::vector<TestFailure *>;
+//  template class CPPUNIT_API std::vector<Test *>;
 #endif
 
 
@@ -31,13 +32,35 @@ CPPUNIT_NS_BEGIN
  * A failure is anticipated and checked for with assertions. Errors are
  * unanticipated problems signified by exceptions that are not generated
  * by the framework.
+ *
+ * Each run test is stored as a row of columns kept in contiguous arrays, all
+ * indexed like tests(): the test, its status, its duration, the index of its
+ * first failure in failures() and, if enabled with setCollectResourceUsage(),
+ * its resource usage. Outputters should walk the columns they need instead
+ * of looking up the failures of each test. The returned columns are not
+ * synchronized: they must not be read while tests are run.
  * \see TestListener, TestFailure.
  */
 class CPPUNIT_API TestResultCollector : public TestSuccessListener
 {
 public:
-  typedef CppUnitDeque<TestFailure *> TestFailures;
-  typedef CppUnitDeque<Test *> Tests;
+  /*! \brief Failures of the run tests.
+   *
+   * A vector since CppUnit 1.14.x, a deque before: code naming the container
+   * type, or built against an older version, must be rebuilt. The failures are
+   * shared with TestFailure::share(), not cloned.
+   */
+  typedef CppUnitVector<TestFailure *> TestFailures;
+
+  /// Run tests. A vector since CppUnit 1.14.x, a deque before.
+  typedef CppUnitVector<Test *> Tests;
+
+  /// Status of a run test.
+  typedef TestRecord::Status TestStatus;
+  typedef CppUnitVector<TestStatus> TestStatuses;
+  typedef CppUnitVector<int> FailureIndexes;
+  typedef CppUnitVector<unsigned long long> Counters;
+  typedef CppUnitVector<bool> Flags;
 
 
   /*! Constructs a TestResultCollector object.
@@ -49,6 +72,21 @@ public:
 
   void startTest( Test *test );
   void addFailure( const TestFailure &failure );
+  void endTest( Test *test );
+
+  /*! \brief Adds a test that was not run, whose passing result was cached.
+   * \param test Cached test.
+   * \param duration Duration of the cached run, in microseconds.
+   * \see TestResultCache.
+   */
+  void addCachedTest( Test *test, unsigned long long duration );
+
+  /*! \brief Enables the collection of the CPU time and memory of each test.
+   *
+   * Disabled by default, since sampling the resource usage costs two system
+   * calls per test.
+   */
+  void setCollectResourceUsage( bool collect );
 
   virtual void reset();
 
@@ -57,15 +95,52 @@ public:
   virtual int testFailures() const;
   virtual int testFailuresTotal() const;
 
+  /// Returns the number of run tests whose result was cached.
+  virtual int cachedTests() const;
+
   virtual const TestFailures& failures() const;
   virtual const Tests &tests() const;
 
+  /*! \brief Returns the status of the run tests.
+   *
+   * A test that did not end yet is TestRecord::running.
+   */
+  virtual const TestStatuses &testStatuses() const;
+
+  /// Returns the duration of the run tests, in microseconds.
+  virtual const Counters &testDurations() const;
+
+  /// Returns the index in failures() of the first failure of the run tests, -1 if none.
+  virtual const FailureIndexes &testFailureIndexes() const;
+
+  /// Returns the CPU time of the run tests in microseconds, 0 if not collected.
+  virtual const Counters &testCpuTimes() const;
+
+  /// Returns the peak resident memory in kilobytes at the end of the run tests, 0 if not collected.
+  virtual const Counters &testPeakMemories() const;
+
+  /// Indicates for the run tests if their result was cached instead of run.
+  virtual const Flags &testCachedFlags() const;
+
 protected:
   void freeFailures();
 
   Tests m_tests;
   TestFailures m_failures;
   int m_testErrors;
+  TestStatuses m_testStatuses;
+  Counters m_testDurations;
+  FailureIndexes m_testFailureIndexes;
+  Counters m_testCpuTimes;
+  Counters m_testPeakMemories;
+  Flags m_testCachedFlags;
+  int m_cachedTests;
+
+  /// Index of the test being run, -1 if none.
+  int m_currentTest;
+  unsigned long long m_startTime;
+  unsigned long long m_startCpuTime;
+  bool m_collectResourceUsage;
 
 private:
   /// Prevents the use of the copy constructor.
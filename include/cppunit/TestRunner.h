@@ -8,6 +8,7 @@ CPPUNIT_NS_BEGIN
 
 
 class Test;
+class TestNameIndex;
 class TestResult;
 
 
@@ -102,18 +103,35 @@ protected:
   public:
     WrappingSuite( const std::string &name = "All Tests" );
 
+    ~WrappingSuite();
+
+    void addTest( Test *test );
+
     int getChildTestCount() const;
 
     std::string getName() const;
 
     void run( TestResult *result );
 
+    /*! Finds the test with the specified name or scoped name using an index.
+     *
+     * The index of the names of the whole hierarchy is built by the first
+     * lookup. Tests added below the root afterward are still found.
+     * \see Test::findTestPath().
+     */
+    bool findTestPath( const std::string &testName, TestPath &testPath ) const;
+
+    using Test::findTestPath;
+
   protected:
     Test *doGetChildTestAt( int index ) const;
 
     bool hasOnlyOneTest() const;
 
     Test *getUniqueChildTest() const;
+
+  private:
+    TestNameIndex *m_index;
   };
 
 protected:
@@ -0,0 +1,111 @@
+#ifndef CPPUNIT_TESTSERVER_H
+#define CPPUNIT_TESTSERVER_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/TestListener.h>
+#include <cppunit/TestRecord.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+class LocalSocket;
+class Test;
+class TestResult;
+class TestResultCollector;
+
+
+/*! \brief Runs tests on request, received over a local socket.
+ * \ingroup ExecutingTest
+ *
+ * The server keeps the process, its test tree and its global state alive
+ * between runs, so that a run does not pay again for the process startup,
+ * the static registration of the tests and the initialization of shared
+ * data. One client is served at a time, and a client may send several
+ * requests over the same connection.
+ *
+ * A request is a line of words separated by spaces: test paths, as given to
+ * TestRunner::run(), and <tt>-f PATTERNS</tt> filters, as given to
+ * TestNameFilter::addPatterns(). An empty request runs all the tests. The
+ * request <tt>--shutdown</tt> stops the server.
+ *
+ * The events of the run are streamed back as they happen, one line each.
+ * Fields are separated by tabs, and tabs, new lines and backslashes in the
+ * fields are escaped as \c \\t, \c \\n and \c \\\\:
+ * \code
+ * start	FooTest::testBar
+ * failure	FooTest::testBar	assertion	FooTest.cpp	42	equality assertion failed\n- Expected: 1\n- Actual  : 2
+ * end	FooTest::testBar	failure	1520
+ * result	8	1	0
+ * \endcode
+ *
+ * A failure is reported as an \c assertion or an \c error. The status of
+ * \c end is \c success, \c failure or \c error, followed by the duration in
+ * microseconds. The \c result line ends the response with the count of tests
+ * run, failures and errors. A request that can not be run gets a single
+ * \c error line with the reason instead.
+ *
+ * The TestResult and the TestResultCollector are reset before each request.
+ * If the client disconnects during a run, the run is stopped.
+ */
+class CPPUNIT_API TestServer : public TestListener
+{
+public:
+	/*! \brief Listens to the socket.
+	 * \param root Test to run the requested paths in.
+	 * \param controller TestResult used to run the tests.
+	 * \param result Collector registered to \a controller, reset before each request.
+	 * \param socketPath Path of the local socket.
+	 * \exception std::runtime_error if the socket can not be created.
+	 */
+	TestServer(Test* root, TestResult* controller, TestResultCollector* result, const std::string& socketPath);
+
+	/// Closes and removes the socket.
+	virtual ~TestServer();
+
+	/// Serves the requests until a shutdown request is received.
+	void serve();
+
+	/*! \brief Runs a request and streams its events to the client.
+	 * \return \c false if the request is a shutdown request.
+	 */
+	bool runRequest(const std::string& request);
+
+	void startTest(Test* test);
+	void addFailure(const TestFailure& failure);
+	void endTest(Test* test);
+
+private:
+	void send(const std::string& line);
+	static void appendField(std::string& line, const std::string& field);
+
+	/// Prevents the use of the copy constructor.
+	TestServer(const TestServer& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const TestServer& copy);
+
+private:
+	Test*                m_root;
+	TestResult*          m_controller;
+	TestResultCollector* m_result;
+	LocalSocket*         m_socket;
+	TestRecord           m_record;
+	unsigned long long   m_startTime;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_TESTSERVER_H
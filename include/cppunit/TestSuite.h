@@ -10,6 +10,7 @@
 
 #include <cppunit/TestComposite.h>
 #include <cppunit/portability/CppUnitVector.h>
+#include <string>
 
 CPPUNIT_NS_BEGIN
 
@@ -62,12 +63,25 @@ public:
    */
   virtual void deleteContents();
 
+  /*! Sets a property of the suite, replacing the value it may have.
+   * \param key Key of the property.
+   * \param value Value of the property.
+   */
+  void addProperty( const std::string &key,
+                    const std::string &value );
+
+  std::string getProperty( const std::string &key ) const;
+
   int getChildTestCount() const;
 
   Test *doGetChildTestAt( int index ) const;
 
 private:
+  typedef std::pair<std::string,std::string> Property;
+  typedef CppUnitVector<Property> Properties;
+
   CppUnitVector<Test *> m_tests;
+  Properties m_properties;
 };
 
 
@@ -37,6 +37,7 @@ public:
   virtual void printFailureType( TestFailure *failure );
   virtual void printFailureLocation( SourceLine sourceLine );
   virtual void printFailureDetail( Exception *thrownException );
+  virtual void printCapturedOutput( TestFailure *failure );
   virtual void printFailureWarning();
   virtual void printStatistics();
 
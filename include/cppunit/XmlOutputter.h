@@ -85,6 +85,12 @@ public:
    */
   virtual void setStandalone( bool standalone );
 
+  /*! \brief Map of the failed tests to their first failure.
+   *
+   * setRootNode() fills it with fillFailedTestsMap() for the overrides of
+   * addFailedTests() and addSuccessfulTests(). Their default implementations
+   * ignore it and walk TestResultCollector::testFailureIndexes() instead.
+   */
   typedef CppUnitMap<Test *,TestFailure*, std::less<Test*> > FailedTests;
 
   /*! \brief Sets the root element and adds its children.
@@ -134,6 +140,7 @@ public:
                                   int testNumber,
                                   XmlElement *testsNode );
 protected:
+  /// Fills a FailedTests map from the collected failures.
   virtual void fillFailedTestsMap( FailedTests &failedTests );
 
 protected:
@@ -3,6 +3,7 @@
 
 #include <cppunit/extensions/TestSuiteFactory.h>
 #include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/extensions/TestNamer.h>
 #include <string>
 
 CPPUNIT_NS_BEGIN
@@ -45,6 +46,34 @@ public:
     m_registry->registerFactory( &m_factory );
   }
 
+  /** Auto-register the suite factory in the global registry, under the 
+   * fixture name. The suite is made only when it is needed if it is
+   * declared with CPPUNIT_TEST_SUITE().
+   * \param namer Namer of the fixture, which names the suite and its tests.
+   * \see LazyTestSuite.
+   */
+  AutoRegisterSuite( const TestNamer &namer )
+      : m_registry( &TestFactoryRegistry::getRegistry() )
+      , m_factory( namer.getFixtureName() )
+  {
+    registerFactory( namer );
+  }
+
+  /** Auto-register the suite factory in the specified registry, under the 
+   * fixture name. The suite is made only when it is needed if it is
+   * declared with CPPUNIT_TEST_SUITE().
+   * \param name Name of the registry.
+   * \param namer Namer of the fixture, which names the suite and its tests.
+   * \see LazyTestSuite.
+   */
+  AutoRegisterSuite( const std::string &name,
+                     const TestNamer &namer )
+      : m_registry( &TestFactoryRegistry::getRegistry( name ) )
+      , m_factory( namer.getFixtureName() )
+  {
+    registerFactory( namer );
+  }
+
   ~AutoRegisterSuite()
   {
     if ( TestFactoryRegistry::isValid() )
@@ -52,6 +81,16 @@ public:
   }
 
 private:
+  void registerFactory( const TestNamer &namer )
+  {
+    // Only a suite declared with CPPUNIT_TEST_SUITE() is sure to name its
+    // test cases after the fixture, which lets LazyTestSuite skip it by name.
+    if ( IsTestSuiteDeclared<TestCaseType>::value )
+      m_registry->registerFactory( namer.getFixtureName(), &m_factory );
+    else
+      m_registry->registerFactory( &m_factory );
+  }
+
   TestFactoryRegistry *m_registry;
   TestSuiteFactory<TestCaseType> m_factory;
 };
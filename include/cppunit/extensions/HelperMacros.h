@@ -374,6 +374,10 @@ public:									       \
  * \c TestSuiteBuilderContextType is typedef to 
  * TestSuiteBuilderContext<TestFixtureType> declared by CPPUNIT_TEST_SUITE().
  *
+ * The method is also called to describe the suite of a registered fixture
+ * without creating its fixtures (see TestFactory::makeDescription()): \c
+ * context.makeFixture() then returns \c NULL, and must not be dereferenced.
+ *
  * Here is an example that add two custom tests:
  *
  * \code
@@ -418,6 +422,10 @@ public:									       \
  * Example:
  * \code
  * CPPUNIT_TEST_SUITE_PROPERTY("XmlFileName", "paraTest.xml"); \endcode
+ *
+ * The property \c InputFiles declares the files read by the tests of the
+ * suite, separated by ';': a change of these files invalidates their cached
+ * results (see TestResultCache).
  */
 #define CPPUNIT_TEST_SUITE_PROPERTY( APropertyKey, APropertyValue ) \
     context.addProperty( std::string(APropertyKey),                 \
@@ -435,6 +443,10 @@ public:									       \
  * of such factories.  The registry is available by calling
  * the static function CppUnit::TestFactoryRegistry::getRegistry().
  * 
+ * If the suite is declared with CPPUNIT_TEST_SUITE(), it is registered under
+ * the name of the fixture, and is only made when one of its tests is
+ * selected. Otherwise, it is made by TestFactoryRegistry::makeTest().
+ *
  * \param ATestFixtureType Type of the test case class.
  * \warning This macro should be used only once per line of code (the line
  *          number is used to name a hidden static variable).
@@ -446,7 +458,8 @@ public:									       \
  */
 #define CPPUNIT_TEST_SUITE_REGISTRATION( ATestFixtureType )      \
   static CPPUNIT_NS::AutoRegisterSuite< ATestFixtureType >       \
-             CPPUNIT_MAKE_UNIQUE_NAME(autoRegisterRegistry__ )
+             CPPUNIT_MAKE_UNIQUE_NAME(autoRegisterRegistry__ )(  \
+                 CPPUNIT_TESTNAMER( ATestFixtureType ) )
 
 
 /** Adds the specified fixture suite to the specified registry suite.
@@ -488,7 +501,8 @@ public:									       \
  */
 #define CPPUNIT_TEST_SUITE_NAMED_REGISTRATION( ATestFixtureType, suiteName ) \
   static CPPUNIT_NS::AutoRegisterSuite< ATestFixtureType >                   \
-             CPPUNIT_MAKE_UNIQUE_NAME(autoRegisterRegistry__ )(suiteName)
+             CPPUNIT_MAKE_UNIQUE_NAME(autoRegisterRegistry__ )(suiteName,    \
+                 CPPUNIT_TESTNAMER( ATestFixtureType ) )
 
 /*! Adds that the specified registry suite to another registry suite.
  * \ingroup CreatingTestSuite
@@ -0,0 +1,103 @@
+#ifndef CPPUNIT_EXTENSIONS_LAZYTESTSUITE_H
+#define CPPUNIT_EXTENSIONS_LAZYTESTSUITE_H
+
+#include <cppunit/Portability.h>
+#include <cppunit/Test.h>
+#include <string>
+
+CPPUNIT_NS_BEGIN
+
+
+class TestFactory;
+class TestResult;
+
+
+/*! \brief Suite made by a TestFactory the first time its content is needed.
+ * \ingroup CreatingTestSuite
+ *
+ * The suite knows its name before it is made. All the test cases it contains
+ * must be named "name::...", as the suites declared with CPPUNIT_TEST_SUITE()
+ * are: the name prefix lets the filters (see TestFilter::acceptPrefix()) and
+ * Test::findTestPath() skip the suite without making it.
+ *
+ * Until it is made, the suite is described by TestFactory::makeDescription(),
+ * which lists its test cases and properties without creating their fixtures.
+ *
+ * The made test is owned by the LazyTestSuite. The factory is not.
+ *
+ * \see TestFactoryRegistry.
+ */
+class CPPUNIT_API LazyTestSuite : public Test
+{
+public:
+	/*! \brief Constructs the suite.
+	 * \param name Name of the test made by \a factory.
+	 * \param factory Factory used to make the test. Must not be \c NULL.
+	 */
+	LazyTestSuite(const std::string& name, TestFactory* factory);
+
+	/// Destroys the made test.
+	~LazyTestSuite();
+
+	/*! \brief Runs the made test, if some of its test cases should be run.
+	 *
+	 * If the suite can not be made, for example because the plug-in that
+	 * defines it fails to initialize, the error is reported by the protectors
+	 * of \a result, as a test named after the suite.
+	 */
+	void run(TestResult* result);
+
+	/// Returns the count of the description, making the test if there is none.
+	int countTestCases() const;
+
+	int getChildTestCount() const;
+
+	std::string getName() const;
+
+	std::string getScopedName() const;
+
+	/// Returns the name followed by "::".
+	std::string getTestNamePrefix() const;
+
+	/// Returns a property of the description, empty if there is none.
+	std::string getProperty(const std::string& key) const;
+
+	/*! \brief Returns the made test, or a description made by the factory.
+	 * \return Made test if it is made, otherwise description of the factory,
+	 *         \c NULL if the factory can not describe it.
+	 */
+	Test* getDescription() const;
+
+	/// Indicates if the test was made.
+	bool isMade() const;
+
+	/*! \brief Returns the made test, making it if needed.
+	 * \return Test made by the factory. Never \c NULL.
+	 */
+	Test* getTest() const;
+
+protected:
+	Test* doGetChildTestAt(int index) const;
+
+	/// Makes the test if needed, reporting a failure to \a result. Returns \c true if made.
+	bool make(TestResult* result);
+
+private:
+	/// Prevents the use of the copy constructor.
+	LazyTestSuite(const LazyTestSuite& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const LazyTestSuite& copy);
+
+private:
+	std::string   m_name;
+	TestFactory*  m_factory;
+	mutable Test* m_test;
+	mutable Test* m_description;
+	mutable bool  m_isDescribed;
+};
+
+
+CPPUNIT_NS_END
+
+#endif // CPPUNIT_EXTENSIONS_LAZYTESTSUITE_H
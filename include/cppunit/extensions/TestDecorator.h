@@ -32,6 +32,8 @@ public:
 
   int getChildTestCount() const;
 
+  bool keepsChildTestsGrouped() const;
+
 protected:
   Test *doGetChildTestAt( int index ) const;
 
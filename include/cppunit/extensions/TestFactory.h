@@ -19,6 +19,17 @@ public:
    * \return A new Test.
    */
   virtual Test* makeTest() = 0;
+
+  /*! Makes a description of the test made by makeTest().
+   *
+   * The description has the same test names and properties, but creates no
+   * fixture and can not be run. See Test::getDescription().
+   * \return A new Test, or \c NULL if the test can not be described (default).
+   */
+  virtual Test* makeDescription()
+  {
+    return NULL;
+  }
 };
 
 
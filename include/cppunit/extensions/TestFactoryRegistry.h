@@ -8,7 +8,8 @@
 #pragma warning( disable: 4251)  // X needs to have dll-interface to be used by clients of class Z
 #endif
 
-#include <cppunit/portability/CppUnitSet.h>
+#include <cppunit/portability/CppUnitMap.h>
+#include <cppunit/portability/CppUnitVector.h>
 #include <cppunit/extensions/TestFactory.h>
 #include <string>
 
@@ -18,7 +19,7 @@ CPPUNIT_NS_BEGIN
 class TestSuite;
 
 #if CPPUNIT_NEED_DLL_DECL
-//  template class CPPUNIT_API std::set<TestFactory *>;
+//  template class CPPUNIT_API std::map<TestFactory *, std::string>;
 #endif
 
 
@@ -74,6 +75,13 @@ class TestSuite;
  * Since a TestFactoryRegistry is a TestFactory, the named registries can be 
  * registered in the unnamed registry, creating the hierarchy links.
  *
+ * The tests are added to the suite in the order of their names, so that the
+ * order does not depend on the build. The factories registered with the name
+ * of their suite, as CPPUNIT_TEST_SUITE_REGISTRATION() does for the suites
+ * declared with CPPUNIT_TEST_SUITE(), are not called by makeTest(): they are
+ * wrapped in a LazyTestSuite, which makes the suite only when one of its test
+ * cases is selected or run.
+ *
  * \see TestSuiteFactory, AutoRegisterSuite
  * \see CPPUNIT_TEST_SUITE_REGISTRATION, CPPUNIT_TEST_SUITE_NAMED_REGISTRATION
  */
@@ -91,7 +99,7 @@ public:
 
   /** Returns a new TestSuite that contains the registered test.
    * \return A new TestSuite which contains all the test added using 
-   * registerFactory(TestFactory *).
+   * registerFactory(), ordered by name.
    */
   virtual Test *makeTest();
 
@@ -125,6 +133,17 @@ public:
    */
   void unregisterFactory( TestFactory *factory );
 
+  /*! Returns the registered factories.
+   * \param factories Receives the factories, in no particular order.
+   */
+  void getFactories( CppUnitVector<TestFactory *> &factories ) const;
+
+  /*! Returns the name a factory was registered with.
+   * \param factory Registered factory.
+   * \return Name passed to registerFactory(), empty if none.
+   */
+  std::string getFactoryName( TestFactory *factory ) const;
+
   /*! Adds a registry to the registry.
    * 
    * Convenience method to help create test hierarchy. See TestFactoryRegistry detail
@@ -152,10 +171,11 @@ public:
    */
   static bool isValid();
 
-  /** Adds the specified TestFactory with a specific name (DEPRECATED).
-   * \param name Name associated to the factory.
+  /** Adds the specified TestFactory, whose suite is made only when needed.
+   * \param name Name of the test made by the factory. The test cases it
+   *             contains must be named "name::...".
    * \param factory Factory to register. 
-   * \deprecated Use registerFactory( TestFactory *) instead.
+   * \see LazyTestSuite.
    */
   void registerFactory( const std::string &name,
                         TestFactory *factory );
@@ -165,7 +185,8 @@ private:
   void operator =( const TestFactoryRegistry &copy );
 
 private:
-  typedef CppUnitSet<TestFactory *, std::less<TestFactory*> > Factories;
+  /// Name of the test made by each factory, empty if unknown.
+  typedef CppUnitMap<TestFactory *, std::string, std::less<TestFactory*> > Factories;
   Factories m_factories;
 
   std::string m_name;
@@ -43,6 +43,22 @@ class ConcretTestFixtureFactory : public CPPUNIT_NS::TestFixtureFactory
 };
 
 
+/*! \brief TestFixture factory that makes no fixture (Implementation).
+ *
+ * Implementation detail. Used to describe a suite without creating its
+ * fixtures, see TestFactory::makeDescription().
+ */
+class NullTestFixtureFactory : public CPPUNIT_NS::TestFixtureFactory
+{
+  /*! \brief Returns \c NULL.
+   */
+  TestFixture *makeFixture()
+  {
+    return NULL;
+  }
+};
+
+
 CPPUNIT_NS_END
 
 
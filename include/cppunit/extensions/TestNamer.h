@@ -38,6 +38,21 @@
 #endif
 
 
+/*! \def CPPUNIT_TESTNAMER( FixtureType )
+ * \brief Constructs a temporary TestNamer, named like CPPUNIT_TESTNAMER_DECL() does.
+ *
+ * \relates TestNamer
+ * \see CPPUNIT_TESTNAMER_DECL
+ */
+#if CPPUNIT_USE_TYPEINFO_NAME
+#  define CPPUNIT_TESTNAMER( FixtureType )                          \
+              CPPUNIT_NS::TestNamer( typeid(FixtureType) )
+#else
+#  define CPPUNIT_TESTNAMER( FixtureType )                          \
+              CPPUNIT_NS::TestNamer( std::string(#FixtureType) )
+#endif
+
+
 
 CPPUNIT_NS_BEGIN
 
@@ -0,0 +1,150 @@
+#ifndef CPPUNIT_EXTENSIONS_TESTREGISTRATIONTABLE_H
+#define CPPUNIT_EXTENSIONS_TESTREGISTRATIONTABLE_H
+
+#include <cppunit/Portability.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/extensions/TestFactory.h>
+#include <string>
+
+#if defined(__GNUC__) && defined(__ELF__)
+/// \internal The registrations are placed in the "cppunit_tests" ELF section.
+# define CPPUNIT_HAVE_TEST_SECTION 1
+#endif
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief Descriptor of a statically registered test.
+ *
+ * Only contains constants, so that it is initialized at compile time.
+ * \see CPPUNIT_REGISTER_TEST, TestRegistrationTable.
+ */
+struct TestRegistration
+{
+	/// Name of the fixture, used to name its suite.
+	const char* fixtureName;
+	/// Name of the test method.
+	const char* testName;
+	/// Creates the test case. The fixture is created when the test is set up.
+	Test* (*makeTest)(const char* testName);
+};
+
+
+/// \internal Creates the TestCaller of a statically registered test.
+template<class Fixture, void (Fixture::*testMethod)()>
+Test* makeRegisteredTest(const char* testName)
+{
+	return new TestCaller<Fixture>(testName, testMethod);
+}
+
+
+#if !defined(CPPUNIT_HAVE_TEST_SECTION)
+/*! \brief (INTERNAL) Links a registration when there is no test section.
+ *
+ * The registrations are linked in definition order by static initializers,
+ * without allocating memory.
+ */
+class CPPUNIT_API TestRegistrationLink
+{
+public:
+	TestRegistrationLink(const TestRegistration* registration);
+
+	const TestRegistration* m_registration;
+	const TestRegistrationLink* m_next;
+
+	static const TestRegistrationLink* s_first;
+	static TestRegistrationLink* s_last;
+};
+#endif
+
+
+/*! \brief Factory of the tests registered with CPPUNIT_REGISTER_TEST().
+ * \ingroup CreatingTestSuite
+ *
+ * The registrations are constant descriptors placed by the linker in a
+ * dedicated section of the executable (on ELF platforms), so registering a
+ * test costs no static initializer and no memory allocation. The table is
+ * walked when makeTest() is called: the tests are grouped in a TestSuite per
+ * fixture, in the order of the registrations in the executable. That order is
+ * the link order of the object files, then the order of definition.
+ *
+ * \code
+ * // MyTest.cpp
+ * CPPUNIT_REGISTER_TEST( MyTest, testAdd );
+ * CPPUNIT_REGISTER_TEST( MyTest, testSub );
+ *
+ * // main.cpp
+ * CppUnit::TestRegistrationTable table;
+ * runner.addTest( table.makeTest() );
+ * \endcode
+ *
+ * On other platforms, each registration is linked into a list by a static
+ * initializer, which does not allocate memory either.
+ */
+class CPPUNIT_API TestRegistrationTable : public TestFactory
+{
+public:
+	/*! \brief Constructs the factory.
+	 * \param name Name of the TestSuite returned by makeTest().
+	 */
+	TestRegistrationTable(const std::string& name = "All Tests");
+
+	/// Destructor.
+	virtual ~TestRegistrationTable();
+
+	/*! \brief Returns a new TestSuite that contains a suite per registered fixture.
+	 *
+	 * No fixture is instantiated.
+	 */
+	Test* makeTest();
+
+	/// Returns the number of registered tests.
+	static int testCount();
+
+private:
+	std::string m_name;
+};
+
+
+CPPUNIT_NS_END
+
+
+#if defined(CPPUNIT_HAVE_TEST_SECTION)
+# define CPPUNIT_TEST_REGISTRATION_ENTRY( registration )                       \
+  static const CPPUNIT_NS::TestRegistration *const                            \
+      CPPUNIT_JOIN( registration, Entry__ )                                    \
+      __attribute__(( used, section( "cppunit_tests" ) )) = &registration
+#else
+# define CPPUNIT_TEST_REGISTRATION_ENTRY( registration )                       \
+  static CPPUNIT_NS::TestRegistrationLink                                     \
+      CPPUNIT_JOIN( registration, Entry__ )( &registration )
+#endif
+
+/// \internal Defines the registration and its table entry.
+#define CPPUNIT_REGISTER_TEST_AS( ATestFixtureType, testMethod, registration ) \
+  static const CPPUNIT_NS::TestRegistration registration = {                  \
+      #ATestFixtureType,                                                      \
+      #testMethod,                                                            \
+      &CPPUNIT_NS::makeRegisteredTest< ATestFixtureType,                      \
+                                       &ATestFixtureType::testMethod > };     \
+  CPPUNIT_TEST_REGISTRATION_ENTRY( registration )
+
+/*! Registers a test method in the TestRegistrationTable.
+ * \ingroup CreatingTestSuite
+ *
+ * Must be used at namespace scope. The test method must be public, and have
+ * the signature <tt>void testMethod()</tt>.
+ *
+ * \param ATestFixtureType Type of the test case class.
+ * \param testMethod Name of the test method.
+ * \warning This macro should be used only once per line of code (the line
+ *          number is used to name hidden static variables).
+ * \see TestRegistrationTable.
+ */
+#define CPPUNIT_REGISTER_TEST( ATestFixtureType, testMethod )                  \
+  CPPUNIT_REGISTER_TEST_AS( ATestFixtureType, testMethod,                      \
+                            CPPUNIT_MAKE_UNIQUE_NAME( testRegistration__ ) )
+
+
+#endif  // CPPUNIT_EXTENSIONS_TESTREGISTRATIONTABLE_H
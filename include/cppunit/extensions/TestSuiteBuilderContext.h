@@ -63,6 +63,8 @@ public:
   std::string getTestNameFor( const std::string &testMethodName ) const;
 
   /*! \brief Adds property pair.
+   *
+   * The property is also set on the fixture suite, see TestSuite::getProperty().
    * \param key   PropertyKey string to add.
    * \param value PropertyValue string to add.
    */
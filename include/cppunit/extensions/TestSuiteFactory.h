@@ -2,12 +2,109 @@
 #define CPPUNIT_EXTENSIONS_TESTSUITEFACTORY_H
 
 #include <cppunit/extensions/TestFactory.h>
+#include <cppunit/extensions/TestFixtureFactory.h>
+#include <cppunit/extensions/TestNamer.h>
+#include <cppunit/extensions/TestSuiteBuilderContext.h>
+#include <cppunit/TestSuite.h>
+#include <string>
 
 CPPUNIT_NS_BEGIN
 
 
   class Test;
 
+  /*! \brief (Implementation) Tells if two types are the same.
+   */
+  template<class Type, class OtherType>
+  struct IsSameTestType
+  {
+    enum { value = false };
+  };
+
+  template<class Type>
+  struct IsSameTestType<Type, Type>
+  {
+    enum { value = true };
+  };
+
+  /*! \brief (Implementation) Defines \c Type if \a condition is \c true.
+   */
+  template<bool condition>
+  struct EnableTestType
+  {
+  };
+
+  template<>
+  struct EnableTestType<true>
+  {
+    typedef int Type;
+  };
+
+  /*! \brief (Implementation) Tells if a fixture declares its suite with CPPUNIT_TEST_SUITE().
+   *
+   * The test cases of such a suite are named after the fixture, see
+   * TestNamer::getTestNameFor(). A fixture that inherits the declaration of
+   * its parent class, but implements its own suite(), is not declared.
+   */
+  template<class TestCaseType>
+  class IsTestSuiteDeclared
+  {
+    typedef char Yes;
+    struct No { char value[2]; };
+
+    template<class Type>
+    static Yes check( typename EnableTestType<IsSameTestType<Type, typename Type::TestFixtureType>::value>::Type * );
+
+    template<class Type>
+    static No check( ... );
+
+  public:
+    enum { value = sizeof( check<TestCaseType>( 0 ) ) == sizeof( Yes ) };
+  };
+
+
+  /*! \brief (Implementation) Describes the suite of a fixture that is not declared.
+   */
+  template<class TestCaseType, bool isDeclared>
+  struct TestSuiteDescriber
+  {
+    static Test *describe( const std::string & )
+    {
+      return NULL;
+    }
+  };
+
+  /*! \brief (Implementation) Describes the suite declared with CPPUNIT_TEST_SUITE().
+   *
+   * The test cases are added as the suite() of the fixture does, but with a
+   * NullTestFixtureFactory: the fixtures are not created.
+   */
+  template<class TestCaseType>
+  struct TestSuiteDescriber<TestCaseType, true>
+  {
+    static Test *describe( const std::string &fixtureName )
+    {
+      if ( fixtureName.empty() )
+        return NULL;
+
+      TestSuite *suite = new TestSuite( fixtureName );
+      try
+      {
+        TestNamer namer( fixtureName );
+        NullTestFixtureFactory factory;
+        TestSuiteBuilderContextBase context( *suite, namer, factory );
+        TestCaseType::addTestsToSuite( context );
+      }
+      catch ( ... )
+      {
+        delete suite;
+        throw;
+      }
+      return suite;
+    }
+  };
+
+
   /*! \brief TestFactory for TestFixture that implements a static suite() method.
    * \see AutoRegisterSuite.
    */
@@ -15,10 +112,31 @@ CPPUNIT_NS_BEGIN
   class TestSuiteFactory : public TestFactory
   {
   public:
+    /*! \brief Constructs the factory.
+     * \param fixtureName Name of the fixture, used to describe its suite.
+     */
+    TestSuiteFactory( const std::string &fixtureName = std::string() )
+        : m_fixtureName( fixtureName )
+    {
+    }
+
     virtual Test *makeTest()
     {
       return TestCaseType::suite();
     }
+
+    /*! \brief Describes the suite declared with CPPUNIT_TEST_SUITE().
+     * \return Description of the suite named after the fixture name, \c NULL
+     *         if the suite is not declared or the fixture name is unknown.
+     */
+    virtual Test *makeDescription()
+    {
+      return TestSuiteDescriber<TestCaseType,
+                                IsTestSuiteDeclared<TestCaseType>::value>::describe( m_fixtureName );
+    }
+
+  private:
+    std::string m_fixtureName;
   };
 
 
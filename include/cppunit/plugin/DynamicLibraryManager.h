@@ -28,7 +28,8 @@ CPPUNIT_NS_BEGIN
  * - Updated the 'guard' in your file (CPPUNIT_HAVE_XYZ_DLL_LOADER) so that it is
  *   only processed if the matching platform has been detected.
  * - Change the implementation of methods doLoadLibrary(), doReleaseLibrary(), 
- *   doFindSymbol() in your copy. Those methods usually maps directly to OS calls.
+ *   doFindSymbol() and doFindLibraryBase() in your copy. Those methods usually
+ *   maps directly to OS calls.
  * - Adds the file to the project.
  */
 class DynamicLibraryManager
@@ -37,12 +38,28 @@ public:
   typedef void *Symbol;
   typedef void *LibraryHandle;
 
+  /*! \brief Options of the loading of a library, combined with '|'.
+   *
+   * By default, all the symbols are bound when the library is loaded, and are
+   * visible to the libraries loaded after it. The options are ignored by the
+   * platforms that do not support them.
+   */
+  enum LoadFlags
+  {
+    /// Binds the functions when they are first called (RTLD_LAZY).
+    lazyBinding = 1,
+    /// Keeps the symbols from the libraries loaded after this one (RTLD_LOCAL).
+    localSymbols = 2
+  };
+
   /*! \brief Loads the specified library.
    * \param libraryFileName Name of the library to load.
+   * \param flags Combination of LoadFlags.
    * \exception DynamicLibraryManagerException if a failure occurs while loading
    *            the library (fail to found or load the library).
    */
-  DynamicLibraryManager( const std::string &libraryFileName );
+  DynamicLibraryManager( const std::string &libraryFileName,
+                         int flags = 0 );
 
   /// Releases the loaded library..
   ~DynamicLibraryManager();
@@ -54,6 +71,13 @@ public:
    */
   Symbol findSymbol( const std::string &symbol );
 
+  /*! \brief Returns the base address of the library that contains an address.
+   * \param address Address of some code or data.
+   * \return Base address of the library or executable, \c NULL if unknown or
+   *         if the platform can not tell.
+   */
+  static const void *findLibraryBase( const void *address );
+
 private:
   /*! Loads the specified library.
    * \param libraryName Name of the library to load.
@@ -92,6 +116,11 @@ private:
    */
   Symbol doFindSymbol( const std::string &symbol );
 
+  /*! Returns the base address of the library that contains an address.
+   * \return Base address, \c NULL if unknown.
+   */
+  static const void *doFindLibraryBase( const void *address );
+
   /*! Returns detailed information about doLoadLibrary() failure.
    *
    * Called just after a failed call to doLoadLibrary() to get extra
@@ -111,6 +140,7 @@ private:
 private:
   LibraryHandle m_libraryHandle;
   std::string m_libraryName;
+  int m_flags;
 };
 
 
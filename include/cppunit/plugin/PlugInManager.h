@@ -11,12 +11,18 @@
 #endif
 
 #include <cppunit/plugin/PlugInParameters.h>
+#include <cppunit/portability/CppUnitSet.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <string>
 struct CppUnitTestPlugIn;
 
 CPPUNIT_NS_BEGIN
 
 
 class DynamicLibraryManager;
+class Test;
+class TestFactory;
+class TestManifest;
 class TestResult;
 class XmlOutputter;
 
@@ -33,28 +39,108 @@ public:
   /// Destructor.
   virtual ~PlugInManager();
 
+  /*! \brief Options of load(), combined with '|'.
+   */
+  enum LoadFlags
+  {
+    /// See DynamicLibraryManager::lazyBinding.
+    lazyBinding = 1,
+    /// See DynamicLibraryManager::localSymbols.
+    localSymbols = 2,
+    /*! Delays CppUnitTestPlugIn::initialize() until a suite registered by
+     * the plug-in is made, which the default TestFactoryRegistry does when
+     * one of its test cases is first selected (see LazyTestSuite). The
+     * plug-in is initialized before the fixtures of the suite are built and
+     * before any TestSetUp of the suite is set up, but after the listeners
+     * of addListener() are registered and the test run started. It is never
+     * initialized if none of its suites are made. If initialize() fails, the
+     * suite reports the error as a test named after it. Only the factories
+     * registered when the plug-in is loaded are deferred. Ignored if the
+     * platform can not tell which library a factory comes from.
+     */
+    deferInitialize = 4
+  };
+
   /*! \brief Loads the specified plug-in.
    *
-   * After being loaded, the CppUnitTestPlugIn::initialize() is called.
+   * After being loaded, the CppUnitTestPlugIn::initialize() is called, unless
+   * \a flags contains deferInitialize.
    *
    * \param libraryFileName Name of the file that contains the TestPlugIn.
    * \param parameters List of string passed to the plug-in.
+   * \param flags Combination of LoadFlags.
    * \return Pointer on the DynamicLibraryManager associated to the library.
    *         Valid until the library is unloaded. Never \c NULL.
    * \exception DynamicLibraryManagerException is thrown if an error occurs during loading.
    */
   void load( const std::string &libraryFileName,
-             const PlugInParameters &parameters = PlugInParameters() );
+             const PlugInParameters &parameters = PlugInParameters(),
+             int flags = 0 );
 
   /*! \brief Unloads the specified plug-in.
+   *
+   * CppUnitTestPlugIn::uninitialize() is called if the plug-in was
+   * initialized, and the factories that the plug-in registered to the default
+   * TestFactoryRegistry are removed before the library is released.
+   *
    * \param libraryFileName Name of the file that contains the TestPlugIn passed
    *                        to a previous call to load().
    */
   void unload( const std::string &libraryFileName );
 
+  /*! \brief Reads the manifest of a plug-in without loading it.
+   * \param libraryFileName Name of the file that contains the TestPlugIn.
+   * \param manifest Receives the content of the manifest.
+   * \return \c true if the manifest exists and has the build-id of the
+   *         library, \c false if it is missing or stale.
+   * \see TestManifest::fileName().
+   */
+  static bool readManifest( const std::string &libraryFileName,
+                            TestManifest &manifest );
+
+  /*! \brief Lists the tests of a plug-in.
+   *
+   * The tests are read from the manifest of the plug-in if it is up to date.
+   * Otherwise the plug-in is loaded as by load(), if it was not already, and
+   * its registered tests are listed by addTests(). The durations of a stale
+   * manifest are kept.
+   *
+   * \param libraryFileName Name of the file that contains the TestPlugIn.
+   * \param manifest Receives the tests of the plug-in.
+   * \param parameters List of string passed to the plug-in if it is loaded.
+   * \param flags Combination of LoadFlags used if the plug-in is loaded.
+   * \return \c true if the plug-in was loaded, \c false if the manifest was used.
+   * \exception DynamicLibraryManagerException is thrown if an error occurs during loading.
+   */
+  bool listTests( const std::string &libraryFileName,
+                  TestManifest &manifest,
+                  const PlugInParameters &parameters = PlugInParameters(),
+                  int flags = 0 );
+
+  /*! \brief Adds the test cases of a tree that are defined by a loaded plug-in.
+   *
+   * Test cases are attributed to the plug-in through the factory that made
+   * their suite: the suites made by the factories the plug-in registered by
+   * name in the default registry, such as with CPPUNIT_TEST_SUITE_REGISTRATION(),
+   * are added whole. The other test cases are attributed to the library that
+   * defines their class, which misses the ones whose class comes from another
+   * library, such as the cases of a TestCaseTable when CppUnit is a shared
+   * library. Sets the build-id of the manifest to the one of the library.
+   * Does nothing if the plug-in is not loaded, or if the platform can not tell
+   * which library a factory or a test comes from.
+   *
+   * \param libraryFileName Name of the file passed to load().
+   * \param root Tree to walk, usually made by the TestFactoryRegistry.
+   * \param manifest Receives the test cases, with an unknown duration.
+   */
+  void addTests( const std::string &libraryFileName,
+                 Test *root,
+                 TestManifest &manifest );
+
   /*! \brief Gives a chance to each loaded plug-in to register TestListener.
    *
-   * For each plug-in, call CppUnitTestPlugIn::addListener().
+   * For each plug-in, call CppUnitTestPlugIn::addListener(), even if its
+   * initialization is deferred.
    */
   void addListener( TestResult *eventManager );
 
@@ -81,6 +167,12 @@ protected:
     std::string m_fileName;
     DynamicLibraryManager *m_manager;
     CppUnitTestPlugIn *m_interface;
+    PlugInParameters m_parameters;
+    /// Base address of the library, \c NULL if unknown.
+    const void *m_base;
+    bool m_initialized;
+    /// Factories registered in place of the ones of a deferred plug-in. Owned.
+    CppUnitVector<TestFactory *> m_deferredFactories;
   };
 
   /*! Unloads the specified plug-in.
@@ -88,6 +180,40 @@ protected:
    */
   void unload( PlugInInfo &plugIn );
 
+  /*! Removes from the default registry the factories defined by a plug-in.
+   * \param plugIn Information about the plug-in.
+   */
+  void unregisterFactories( PlugInInfo &plugIn );
+
+  /*! Replaces the factories registered by a deferred plug-in by factories
+   * that initialize it first.
+   * \param plugIn Information about the plug-in.
+   */
+  void deferFactories( PlugInInfo &plugIn );
+
+  /*! Initializes a deferred plug-in, unless it already is.
+   * \param plugIn Interface of the plug-in.
+   */
+  void initialize( CppUnitTestPlugIn *plugIn );
+
+  /*! Collects the names of the factories a plug-in registered in the
+   * default registry.
+   * \param plugIn Information about the plug-in.
+   * \param suites Receives the names of the factories.
+   */
+  static void getSuiteNames( const PlugInInfo &plugIn,
+                             CppUnitSet<std::string> &suites );
+
+  /*! Adds the test cases of a tree that belong to the library at \a base:
+   * the ones below a suite named in \a suites, or defined in the library.
+   */
+  static void addTests( const void *base,
+                        const CppUnitSet<std::string> &suites,
+                        Test *test,
+                        const std::string &suite,
+                        bool isPlugInTest,
+                        TestManifest &manifest );
+
 private:
   /// Prevents the use of the copy constructor.
   PlugInManager( const PlugInManager &copy );
@@ -96,6 +222,8 @@ private:
   void operator =( const PlugInManager &copy );
 
 private:
+  class DeferredFactory;
+
   typedef CppUnitDeque<PlugInInfo> PlugIns;
   PlugIns m_plugIns;
 };
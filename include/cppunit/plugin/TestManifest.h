@@ -0,0 +1,129 @@
+#ifndef CPPUNIT_PLUGIN_TESTMANIFEST_H
+#define CPPUNIT_PLUGIN_TESTMANIFEST_H
+
+#include <cppunit/Portability.h>
+
+#if !defined(CPPUNIT_NO_TESTPLUGIN)
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/portability/CppUnitMap.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief List of the tests of a plug-in, read without loading the plug-in.
+ *
+ * The manifest is a sidecar text file, named after the library with a
+ * \c .manifest suffix (see fileName()). It is stamped with the build-id of the
+ * library it describes, and lists each test case with the suite that contains
+ * it and its last known duration:
+ * \code
+ * CppUnit test manifest 1
+ * build-id	d08e70c11a3e1d150cd418b4ebf4983f606e48d4
+ * suite	FooTest
+ * test	1520	FooTest::testBar
+ * \endcode
+ *
+ * Fields are separated by tabs and durations are in microseconds. A manifest
+ * is stale if the build-id of the library changed since it was written, or if
+ * the library has no build-id.
+ *
+ * \see PlugInManager::listTests().
+ */
+class CPPUNIT_API TestManifest
+{
+public:
+	/// A test case of the manifest.
+	struct Entry
+	{
+		/// Name of the suite that contains the test case.
+		std::string suite;
+		/// Scoped name of the test case.
+		std::string name;
+		/// Duration of the last run in microseconds, 0 if unknown.
+		unsigned long long duration;
+	};
+	typedef CppUnitVector<Entry> Entries;
+
+	/*! \brief Constructs an empty manifest.
+	 * \param buildId Build-id of the library described.
+	 */
+	TestManifest(const std::string& buildId = "");
+
+	/// Destructor.
+	virtual ~TestManifest();
+
+	/// Returns the build-id of the library described.
+	const std::string& buildId() const;
+
+	/// Changes the build-id of the library described.
+	void setBuildId(const std::string& buildId);
+
+	/// Returns the test cases, in the order they were added.
+	const Entries& entries() const;
+
+	/// Adds a test case.
+	void addTest(const std::string& suite, const std::string& name, unsigned long long duration = 0);
+
+	/*! \brief Changes the duration of a test case.
+	 * \return \c false if the manifest does not contain the test case.
+	 */
+	bool setDuration(const std::string& name, unsigned long long duration);
+
+	/*! \brief Takes the durations of another manifest for the test cases of unknown duration.
+	 *
+	 * Keeps the history of the tests that were not run when a manifest is rewritten.
+	 */
+	void mergeDurations(const TestManifest& other);
+
+	/// Removes the test cases.
+	void clear();
+
+	/*! \brief Reads a manifest file.
+	 * \return \c false if the file does not exist or is not a manifest. The
+	 *         manifest is then left empty.
+	 */
+	bool read(const std::string& fileName);
+
+	/*! \brief Writes the manifest file.
+	 * \exception std::runtime_error if the file can not be written.
+	 */
+	void write(const std::string& fileName) const;
+
+	/// Returns the name of the manifest file of a library.
+	static std::string fileName(const std::string& libraryFileName);
+
+	/*! \brief Reads the build-id of a library without loading it.
+	 *
+	 * The build-id is the GNU build-id note of an ELF file, as a lower case
+	 * hexadecimal string.
+	 * \return Build-id, empty if the library has none or the platform does not
+	 *         support it.
+	 */
+	static std::string readBuildId(const std::string& libraryFileName);
+
+private:
+	typedef CppUnitMap<std::string, unsigned int, std::less<std::string> > EntryIndexes;
+
+	std::string  m_buildId;
+	Entries      m_entries;
+	EntryIndexes m_indexes;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif // !defined(CPPUNIT_NO_TESTPLUGIN)
+
+#endif  // CPPUNIT_PLUGIN_TESTMANIFEST_H
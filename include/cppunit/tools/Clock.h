@@ -0,0 +1,23 @@
+#ifndef CPPUNIT_TOOLS_CLOCK_H
+#define CPPUNIT_TOOLS_CLOCK_H
+
+#include <cppunit/Portability.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief (Implementation) Monotonic clock used to time test execution.
+ */
+struct Clock
+{
+	/*! \brief Returns the current time of a monotonic clock.
+	 * \return Time in microseconds since an unspecified starting point.
+	 */
+	static unsigned long long CPPUNIT_API microseconds();
+};
+
+
+CPPUNIT_NS_END
+
+#endif  // CPPUNIT_TOOLS_CLOCK_H
@@ -0,0 +1,90 @@
+#ifndef CPPUNIT_TOOLS_LOCALSOCKET_H
+#define CPPUNIT_TOOLS_LOCALSOCKET_H
+
+#include <cppunit/Portability.h>
+#include <string>
+#include <stddef.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief Listening local stream socket, serving one client at a time.
+ *
+ * The socket is a Unix domain socket bound to a path of the file system. A
+ * stale socket file left at that path is replaced. The file is removed when
+ * the socket is closed.
+ *
+ * Writes to a client that went away fail instead of raising SIGPIPE.
+ *
+ * \internal Implementation of the OS independent methods is in LocalSocket.cpp,
+ * the OS specific methods are in UnixLocalSocket.cpp and Win32LocalSocket.cpp.
+ */
+class CPPUNIT_API LocalSocket
+{
+public:
+	/*! \brief Creates the socket and listens to it.
+	 * \param path Path of the socket.
+	 * \exception std::runtime_error if the socket can not be created.
+	 */
+	LocalSocket(const std::string& path);
+
+	/// Disconnects the client, closes and removes the socket.
+	~LocalSocket();
+
+	/// Returns the path of the socket.
+	const std::string& path() const;
+
+	/*! \brief Disconnects the current client and waits for the next one.
+	 * \return \c false if an error occurred.
+	 */
+	bool accept();
+
+	/*! \brief Reads a line sent by the client.
+	 * \param line Receives the line, without its end of line.
+	 * \return \c false if the client disconnected before sending a full line.
+	 */
+	bool readLine(std::string& line);
+
+	/*! \brief Sends text to the client.
+	 * \return \c false if the client disconnected.
+	 */
+	bool write(const std::string& text);
+
+	/// Disconnects the current client.
+	void disconnect();
+
+	/// Indicates if a client is connected.
+	bool isConnected() const;
+
+private:
+	/// Creates, binds and listens to the socket. Returns \c false on failure.
+	bool doListen();
+	/// Closes and removes the socket. Must NOT throw.
+	void doClose();
+	/// Waits for a client. Returns \c false on failure.
+	bool doAccept();
+	/// Disconnects the client. Must NOT throw.
+	void doDisconnect();
+	/// Receives at most \a size bytes. Returns the count received, 0 at end of connection, -1 on failure.
+	long doRead(char* buffer, size_t size);
+	/// Sends all the bytes. Returns \c false on failure.
+	bool doWrite(const char* data, size_t size);
+
+	/// Prevents the use of the copy constructor.
+	LocalSocket(const LocalSocket& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const LocalSocket& copy);
+
+private:
+	std::string m_path;
+	std::string m_buffer;
+	int         m_listener;
+	int         m_connection;
+};
+
+
+CPPUNIT_NS_END
+
+#endif  // CPPUNIT_TOOLS_LOCALSOCKET_H
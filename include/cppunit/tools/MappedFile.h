@@ -0,0 +1,94 @@
+#ifndef CPPUNIT_TOOLS_MAPPEDFILE_H
+#define CPPUNIT_TOOLS_MAPPEDFILE_H
+
+#include <cppunit/Portability.h>
+#include <string>
+#include <stddef.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief A file mapped in memory.
+ *
+ * The MappedFile provides a platform independent way to map a file in memory.
+ * Writes to a writable mapping go to the system page cache: they survive the
+ * termination of the process without being explicitly synchronized to disk.
+ *
+ * If an error occurs, a std::runtime_error is thrown.
+ *
+ * \internal Implementation of the OS independent methods is in MappedFile.cpp,
+ * the OS specific methods are in UnixMappedFile.cpp and Win32MappedFile.cpp.
+ */
+class CPPUNIT_API MappedFile
+{
+public:
+	/*! \brief Maps the specified file.
+	 * \param fileName Name of the file to map.
+	 * \param writable If \c true, the file is created if it does not exist and
+	 *                 mapped for reading and writing. Otherwise the file is mapped
+	 *                 read-only.
+	 * \exception std::runtime_error if the file can not be opened or mapped.
+	 */
+	MappedFile(const std::string& fileName, bool writable = false);
+
+	/// Unmaps and closes the file.
+	~MappedFile();
+
+	/// Returns the address of the mapped content. \c NULL if the file is empty.
+	char* data() const;
+
+	/// Returns the size of the file in bytes.
+	size_t size() const;
+
+	/*! \brief Changes the size of the file and maps it again.
+	 *
+	 * Bytes added at the end of the file are zero-filled. Pointers previously
+	 * returned by data() are invalidated.
+	 *
+	 * \param size New size of the file in bytes.
+	 * \exception std::runtime_error if the file can not be resized.
+	 */
+	void resize(size_t size);
+
+	/*! \brief Schedules the modified pages to be written to the disk.
+	 *
+	 * Does not wait for the write to complete.
+	 */
+	void flush();
+
+private:
+	/// Maps m_size bytes of the opened file. Returns \c false on failure.
+	bool doMap();
+	/// Unmaps the file. Must NOT throw.
+	void doUnmap();
+	/// Opens the file and sets m_size. Returns \c false on failure.
+	bool doOpen();
+	/// Closes the file. Must NOT throw.
+	void doClose();
+	/// Changes the size of the unmapped file. Returns \c false on failure.
+	bool doResize(size_t size);
+	/// Schedules an asynchronous write of the mapping.
+	void doFlush();
+
+	void throwError(const std::string& operation);
+
+	/// Prevents the use of the copy constructor.
+	MappedFile(const MappedFile& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const MappedFile& copy);
+
+private:
+	std::string m_fileName;
+	bool        m_writable;
+	char*       m_data;
+	size_t      m_size;
+	void*       m_file;
+	void*       m_mapping;
+};
+
+
+CPPUNIT_NS_END
+
+#endif  // CPPUNIT_TOOLS_MAPPEDFILE_H
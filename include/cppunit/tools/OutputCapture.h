@@ -0,0 +1,99 @@
+#ifndef CPPUNIT_TOOLS_OUTPUTCAPTURE_H
+#define CPPUNIT_TOOLS_OUTPUTCAPTURE_H
+
+#include <cppunit/Portability.h>
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( push )
+#pragma warning( disable: 4251 )  // X needs to have dll-interface to be used by clients of class Z
+#endif
+
+#include <cppunit/portability/CppUnitVector.h>
+#include <string>
+#include <stddef.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief Captures the standard output and error of the process.
+ *
+ * While capturing, the file descriptors 1 and 2 are redirected to a pipe, so
+ * the output of child processes and of C code is captured as well as the
+ * output written to std::cout and std::cerr. A thread drains the pipe into a
+ * ring buffer of maxSize() bytes as the output is written: a test that logs
+ * gigabytes uses no more memory than that.
+ *
+ * Only the last maxSize() bytes are kept: if more output was written, the
+ * beginning is dropped and replaced by a truncation marker.
+ *
+ * \internal Implementation of the OS independent methods is in OutputCapture.cpp,
+ * the OS specific methods are in UnixOutputCapture.cpp and Win32OutputCapture.cpp.
+ */
+class CPPUNIT_API OutputCapture
+{
+public:
+	/*! \brief Creates the capture buffer.
+	 * \param maxSize Maximum number of bytes returned by stop().
+	 */
+	OutputCapture(size_t maxSize = 64 * 1024);
+
+	/// Stops capturing and releases the buffer.
+	~OutputCapture();
+
+	/*! \brief Starts redirecting the output to the emptied buffer.
+	 * \exception std::runtime_error if the pipe or its drain thread can not be
+	 *            created, or if the output can not be redirected.
+	 */
+	void start();
+
+	/*! \brief Restores the output and returns what was captured.
+	 * \return Captured output, truncated to maxSize() bytes.
+	 */
+	std::string stop();
+
+	/// Indicates if the output is being captured.
+	bool isCapturing() const;
+
+	/// Returns the maximum number of bytes returned by stop().
+	size_t maxSize() const;
+
+private:
+	/// (INTERNAL) Pipe and drain thread, specific to the OS.
+	struct Pipe;
+
+	/// Creates the pipe, starts draining it and redirects the output to it.
+	/// Returns \c false on failure.
+	bool doRedirect();
+	/// Restores the output, drains the pipe and releases it. Must NOT throw.
+	void doRestore();
+
+	/// Keeps the last maxSize() bytes of the output. Called by the drain thread.
+	void append(const char* data, size_t length);
+
+	void flushStreams();
+
+	/// Prevents the use of the copy constructor.
+	OutputCapture(const OutputCapture& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const OutputCapture& copy);
+
+private:
+	size_t               m_maxSize;
+	bool                 m_capturing;
+	Pipe*                m_pipe;
+	CppUnitVector<char>  m_ring;
+	size_t               m_ringStart;
+	size_t               m_ringLength;
+	unsigned long long   m_dropped;
+};
+
+
+CPPUNIT_NS_END
+
+#if CPPUNIT_NEED_DLL_DECL
+#pragma warning( pop )
+#endif
+
+#endif  // CPPUNIT_TOOLS_OUTPUTCAPTURE_H
@@ -0,0 +1,52 @@
+#ifndef CPPUNIT_TOOLS_REGULAREXPRESSION_H
+#define CPPUNIT_TOOLS_REGULAREXPRESSION_H
+
+#include <cppunit/Portability.h>
+#include <string>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief A compiled POSIX extended regular expression.
+ *
+ * The expression is compiled once on construction. It must match the whole
+ * string, as if it was enclosed in <tt>^(...)$</tt>.
+ *
+ * \internal The OS specific methods are in UnixRegularExpression.cpp and
+ * Win32RegularExpression.cpp.
+ */
+class CPPUNIT_API RegularExpression
+{
+public:
+	/*! \brief Compiles the specified expression.
+	 * \param pattern POSIX extended regular expression.
+	 * \exception std::runtime_error if the expression is invalid.
+	 */
+	RegularExpression(const std::string& pattern);
+
+	/// Releases the compiled expression.
+	~RegularExpression();
+
+	/// Tests if the expression matches the whole \a text.
+	bool matches(const std::string& text) const;
+
+	/// Returns the source of the expression.
+	const std::string& pattern() const;
+
+private:
+	/// Prevents the use of the copy constructor.
+	RegularExpression(const RegularExpression& copy);
+
+	/// Prevents the use of the copy operator.
+	void operator=(const RegularExpression& copy);
+
+private:
+	std::string m_pattern;
+	void*       m_expression;
+};
+
+
+CPPUNIT_NS_END
+
+#endif  // CPPUNIT_TOOLS_REGULAREXPRESSION_H
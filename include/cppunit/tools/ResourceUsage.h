@@ -0,0 +1,26 @@
+#ifndef CPPUNIT_TOOLS_RESOURCEUSAGE_H
+#define CPPUNIT_TOOLS_RESOURCEUSAGE_H
+
+#include <cppunit/Portability.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief (Implementation) Resources used by the process, sampled around a test.
+ */
+struct ResourceUsage
+{
+	/// User and system CPU time in microseconds.
+	unsigned long long cpuTime;
+	/// Peak resident memory in kilobytes.
+	unsigned long long peakMemory;
+
+	/// Returns the resources used so far by the process.
+	static ResourceUsage CPPUNIT_API current();
+};
+
+
+CPPUNIT_NS_END
+
+#endif  // CPPUNIT_TOOLS_RESOURCEUSAGE_H
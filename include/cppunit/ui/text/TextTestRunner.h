@@ -16,6 +16,7 @@ class TestSuite;
 class TextOutputter;
 class TestResult;
 class TestResultCollector;
+class TestOrder;
 
 
 
@@ -71,8 +72,14 @@ public:
 	bool run(int argc, const char* argv[]);
 	bool run(const std::vector<std::string>& testPaths = std::vector<std::string>(), bool doWait = false, bool doPrintResult = true, bool doPrintProgress = true, bool doPrintVerbose = false);
 
+	void listTests(bool doJson = false);
+
+	bool serve(const std::string& socketPath);
+
 	void setOutputter(Outputter *outputter);
 
+	void setTestOrder(TestOrder* order);
+
 	TestResultCollector &result() const;
 
 	TestResult &eventManager() const;
@@ -93,6 +100,7 @@ private:
 	TestResultCollector *m_result;
 	TestResult *m_eventManager;
 	Outputter *m_outputter;
+	TestOrder *m_order;
 };
 
 
@@ -36,6 +36,13 @@ DynamicLibraryManager::doFindSymbol( const std::string &symbol )
 }
 
 
+const void *
+DynamicLibraryManager::doFindLibraryBase( const void * )
+{
+  return NULL;
+}
+
+
 std::string 
 DynamicLibraryManager::getLastErrorDetail() const
 {
@@ -0,0 +1,111 @@
+#ifndef CPPUNIT_BINARYENCODING_H
+#define CPPUNIT_BINARYENCODING_H
+
+#include <cppunit/Portability.h>
+#include <stdexcept>
+#include <string>
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief Little endian encoding of the binary result records (Implementation).
+ * Implementation detail.
+ */
+class BinaryEncoder
+{
+public:
+	BinaryEncoder(std::string& buffer)
+		: m_buffer(buffer)
+	{
+	}
+
+	void putUInt8(unsigned int value)
+	{
+		m_buffer += (char)(value & 0xff);
+	}
+
+	void putUInt32(unsigned int value)
+	{
+		for(int shift = 0; shift < 32; shift += 8)
+			m_buffer += (char)((value >> shift) & 0xff);
+	}
+
+	void putUInt64(unsigned long long value)
+	{
+		for(int shift = 0; shift < 64; shift += 8)
+			m_buffer += (char)((value >> shift) & 0xff);
+	}
+
+	void putString(const std::string& value)
+	{
+		putUInt32(value.length());
+		m_buffer += value;
+	}
+
+private:
+	std::string& m_buffer;
+};
+
+
+/*! \brief Little endian decoding of the binary result records (Implementation).
+ * Implementation detail.
+ * \internal Reading past the end of the buffer throws std::runtime_error.
+ */
+class BinaryDecoder
+{
+public:
+	BinaryDecoder(const std::string& buffer)
+		: m_buffer(buffer)
+		, m_offset(0)
+	{
+	}
+
+	unsigned int getUInt8()
+	{
+		require(1);
+		return (unsigned char)m_buffer[m_offset++];
+	}
+
+	unsigned int getUInt32()
+	{
+		require(4);
+		unsigned int value = 0;
+		for(int shift = 0; shift < 32; shift += 8)
+			value |= (unsigned int)(unsigned char)m_buffer[m_offset++] << shift;
+		return value;
+	}
+
+	unsigned long long getUInt64()
+	{
+		require(8);
+		unsigned long long value = 0;
+		for(int shift = 0; shift < 64; shift += 8)
+			value |= (unsigned long long)(unsigned char)m_buffer[m_offset++] << shift;
+		return value;
+	}
+
+	std::string getString()
+	{
+		unsigned int length = getUInt32();
+		require(length);
+		std::string value = m_buffer.substr(m_offset, length);
+		m_offset += length;
+		return value;
+	}
+
+private:
+	void require(size_t size)
+	{
+		if(m_buffer.length() - m_offset < size)
+			throw std::runtime_error("BinaryResultReader: record is truncated");
+	}
+
+private:
+	const std::string& m_buffer;
+	size_t             m_offset;
+};
+
+
+CPPUNIT_NS_END
+
+#endif // CPPUNIT_BINARYENCODING_H
@@ -0,0 +1,50 @@
+#include <cppunit/BinaryResultListener.h>
+#include <cppunit/Test.h>
+#include <cppunit/tools/Clock.h>
+#include <stdexcept>
+
+
+CPPUNIT_NS_BEGIN
+
+
+BinaryResultListener::BinaryResultListener(const std::string& fileName)
+	: m_stream(fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary)
+	, m_writer(NULL)
+	, m_record()
+	, m_startTime(0)
+{
+	if(! m_stream)
+		throw std::runtime_error("BinaryResultListener: failed to create <" + fileName + ">");
+	m_writer = new BinaryResultWriter(m_stream);
+}
+
+BinaryResultListener::~BinaryResultListener()
+{
+	delete m_writer;
+}
+
+void BinaryResultListener::startTest(Test* test)
+{
+	m_record = TestRecord();
+	m_record.name = test->getScopedName();
+	m_startTime = Clock::microseconds();
+}
+
+void BinaryResultListener::addFailure(const TestFailure& failure)
+{
+	m_record.setFailure(failure);
+}
+
+void BinaryResultListener::endTest(Test*)
+{
+	m_record.duration = Clock::microseconds() - m_startTime;
+	m_writer->write(m_record);
+}
+
+void BinaryResultListener::endTestRun(Test*, TestResult*)
+{
+	m_writer->flush();
+}
+
+
+CPPUNIT_NS_END
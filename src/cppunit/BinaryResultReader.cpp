@@ -0,0 +1,128 @@
+#include <cppunit/BinaryResultReader.h>
+#include <cppunit/BinaryResultWriter.h>
+#include <algorithm>
+#include <string.h>
+#include "BinaryEncoding.h"
+
+
+CPPUNIT_NS_BEGIN
+
+
+namespace
+{
+	/// Longest valid record: larger lengths are read from a corrupted file.
+	const unsigned int maxRecordLength = 256 * 1024 * 1024;
+}
+
+
+BinaryResultReader::BinaryResultReader(std::istream& stream)
+	: m_stream(stream)
+	, m_names()
+	, m_failures()
+{
+	std::string header(sizeof(BinaryResultWriter::magic) + 4, '\0');
+	m_stream.read(&header[0], header.length());
+	if(m_stream.gcount() != (std::streamsize)header.length() || ::memcmp(header.data(), BinaryResultWriter::magic, sizeof(BinaryResultWriter::magic)) != 0)
+		throw std::runtime_error("BinaryResultReader: not a binary result file");
+
+	unsigned int version = BinaryDecoder(header.substr(sizeof(BinaryResultWriter::magic))).getUInt32();
+	if(version != BinaryResultWriter::version)
+		throw std::runtime_error("BinaryResultReader: unsupported version of the binary result format");
+}
+
+BinaryResultReader::~BinaryResultReader()
+{
+}
+
+bool BinaryResultReader::read(TestRecord& record)
+{
+	unsigned int kind;
+	std::string payload;
+	while(readRecord(kind, payload))
+	{
+		BinaryDecoder decoder(payload);
+		if(kind == BinaryResultWriter::nameRecord)
+		{
+			unsigned int id = decoder.getUInt32();
+			if(id != m_names.size())
+				throw std::runtime_error("BinaryResultReader: unexpected test name id");
+			m_names.push_back(decoder.getString());
+		}
+		else if(kind == BinaryResultWriter::failureRecord)
+		{
+			unsigned int id = decoder.getUInt32();
+			TestRecord& failure = m_failures[id];
+			failure.fileName = decoder.getString();
+			failure.lineNumber = (int)decoder.getUInt32();
+			failure.shortDescription = decoder.getString();
+			unsigned int detailCount = decoder.getUInt32();
+			for(unsigned int index = 0; index < detailCount; ++index)
+				failure.details.push_back(decoder.getString());
+			failure.capturedOutput = decoder.getString();
+		}
+		else if(kind == BinaryResultWriter::testRecord)
+		{
+			unsigned int nameId = decoder.getUInt32();
+			if(nameId >= m_names.size())
+				throw std::runtime_error("BinaryResultReader: unknown test name id");
+
+			TestRecord::Status status = (TestRecord::Status)decoder.getUInt8();
+			unsigned long long duration = decoder.getUInt64();
+			unsigned int failureId = decoder.getUInt32();
+
+			record = TestRecord();
+			PendingFailures::iterator it = m_failures.find(failureId);
+			if(it != m_failures.end())
+			{
+				record = it->second;
+				m_failures.erase(it);
+			}
+			record.name = m_names[nameId];
+			record.status = status;
+			record.duration = duration;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool BinaryResultReader::isBinaryResult(std::istream& stream)
+{
+	char header[sizeof(BinaryResultWriter::magic)];
+	std::streampos position = stream.tellg();
+	stream.read(header, sizeof(header));
+	bool isBinary = stream.gcount() == sizeof(header) && ::memcmp(header, BinaryResultWriter::magic, sizeof(header)) == 0;
+	stream.clear();
+	stream.seekg(position);
+	return isBinary;
+}
+
+bool BinaryResultReader::readRecord(unsigned int& kind, std::string& payload)
+{
+	std::string header(5, '\0');
+	m_stream.read(&header[0], header.length());
+	if(m_stream.gcount() != (std::streamsize)header.length())
+		return false;
+
+	BinaryDecoder decoder(header);
+	unsigned int length = decoder.getUInt32();
+	kind = decoder.getUInt8();
+	if(length == 0 || length > maxRecordLength)
+		throw std::runtime_error("BinaryResultReader: invalid record length");
+
+	// Reads by chunks: a truncated file must not make the payload allocated up front.
+	payload.clear();
+	char buffer[64 * 1024];
+	while(payload.length() < length - 1)
+	{
+		std::streamsize count = std::min<size_t>(sizeof(buffer), length - 1 - payload.length());
+		m_stream.read(buffer, count);
+		payload.append(buffer, m_stream.gcount());
+		if(m_stream.gcount() != count)
+			return false;
+	}
+	return true;
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,88 @@
+#include <cppunit/BinaryResultWriter.h>
+#include "BinaryEncoding.h"
+
+
+CPPUNIT_NS_BEGIN
+
+
+const char BinaryResultWriter::magic[8] = { 'C', 'P', 'P', 'U', 'R', 'S', 'L', 'T' };
+const unsigned int BinaryResultWriter::version = 1;
+
+
+BinaryResultWriter::BinaryResultWriter(std::ostream& stream)
+	: m_stream(stream)
+	, m_names()
+	, m_failureCount(0)
+{
+	std::string header(magic, sizeof(magic));
+	BinaryEncoder(header).putUInt32(version);
+	m_stream.write(header.data(), header.length());
+}
+
+BinaryResultWriter::~BinaryResultWriter()
+{
+}
+
+void BinaryResultWriter::write(const TestRecord& record)
+{
+	unsigned int failureId = 0;
+	if(record.isFailure())
+	{
+		failureId = ++m_failureCount;
+
+		std::string payload;
+		BinaryEncoder encoder(payload);
+		encoder.putUInt32(failureId);
+		encoder.putString(record.fileName);
+		encoder.putUInt32((unsigned int)record.lineNumber);
+		encoder.putString(record.shortDescription);
+		encoder.putUInt32(record.details.size());
+		for(unsigned int index = 0; index < record.details.size(); ++index)
+			encoder.putString(record.details[index]);
+		encoder.putString(record.capturedOutput);
+		writeRecord(failureRecord, payload);
+	}
+
+	std::string payload;
+	BinaryEncoder encoder(payload);
+	encoder.putUInt32(nameId(record.name));
+	encoder.putUInt8(record.status);
+	encoder.putUInt64(record.duration);
+	encoder.putUInt32(failureId);
+	writeRecord(testRecord, payload);
+}
+
+void BinaryResultWriter::flush()
+{
+	m_stream.flush();
+}
+
+unsigned int BinaryResultWriter::nameId(const std::string& name)
+{
+	NameIds::iterator it = m_names.find(name);
+	if(it != m_names.end())
+		return it->second;
+
+	unsigned int id = m_names.size();
+	m_names.insert(std::pair<const std::string, unsigned int>(name, id));
+
+	std::string payload;
+	BinaryEncoder encoder(payload);
+	encoder.putUInt32(id);
+	encoder.putString(name);
+	writeRecord(nameRecord, payload);
+	return id;
+}
+
+void BinaryResultWriter::writeRecord(RecordKind kind, const std::string& payload)
+{
+	std::string header;
+	BinaryEncoder encoder(header);
+	encoder.putUInt32(payload.length() + 1);
+	encoder.putUInt8(kind);
+	m_stream.write(header.data(), header.length());
+	m_stream.write(payload.data(), payload.length());
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,34 @@
+#include <cppunit/tools/Clock.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+
+CPPUNIT_NS_BEGIN
+
+
+unsigned long long Clock::microseconds()
+{
+#ifdef _WIN32
+	static LARGE_INTEGER frequency = { 0 };
+	if(frequency.QuadPart == 0)
+		::QueryPerformanceFrequency(&frequency);
+
+	LARGE_INTEGER counter;
+	::QueryPerformanceCounter(&counter);
+	return (unsigned long long)(counter.QuadPart / frequency.QuadPart) * 1000000ULL +
+		(unsigned long long)(counter.QuadPart % frequency.QuadPart) * 1000000ULL / frequency.QuadPart;
+#else
+	struct timespec now;
+	::clock_gettime(CLOCK_MONOTONIC, &now);
+	return (unsigned long long)now.tv_sec * 1000000ULL + now.tv_nsec / 1000;
+#endif
+}
+
+
+CPPUNIT_NS_END
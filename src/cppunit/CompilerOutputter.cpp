@@ -84,6 +84,7 @@ CompilerOutputter::printFailureDetail( TestFailure *failure )
   printFailureType( failure );
   printFailedTestName( failure );
   printFailureMessage( failure );
+  printCapturedOutput( failure );
 }
 
  
@@ -180,6 +181,19 @@ CompilerOutputter::printFailureMessage( TestFailure *failure )
 }
 
 
+void 
+CompilerOutputter::printCapturedOutput( TestFailure *failure )
+{
+  std::string output = failure->capturedOutput();
+  if ( output.empty() )
+    return;
+
+  m_stream  <<  "Captured output:\n"  <<  output;
+  if ( output[ output.length() - 1 ] != '\n' )
+    m_stream  <<  "\n";
+}
+
+
 void 
 CompilerOutputter::printStatistics()
 {
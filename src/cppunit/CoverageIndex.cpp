@@ -0,0 +1,225 @@
+#include <cppunit/CoverageIndex.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <stdlib.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+namespace
+{
+	const char indexHeader[] = "CppUnit coverage index 1";
+}
+
+
+CoverageIndex::CoverageIndex()
+	: m_testNames()
+	, m_testLines()
+	, m_testIndexes()
+	, m_fileNames()
+	, m_fileIndexes()
+	, m_noLines()
+{
+}
+
+CoverageIndex::~CoverageIndex()
+{
+}
+
+unsigned int CoverageIndex::addTest(const std::string& name)
+{
+	Indexes::iterator it = m_testIndexes.find(name);
+	if(it != m_testIndexes.end())
+	{
+		m_testLines[it->second].clear();
+		return it->second;
+	}
+
+	unsigned int test = m_testNames.size();
+	m_testIndexes.insert(std::pair<const std::string, unsigned int>(name, test));
+	m_testNames.push_back(name);
+	m_testLines.push_back(FileLines());
+	return test;
+}
+
+void CoverageIndex::addLine(unsigned int test, const std::string& fileName, unsigned int line)
+{
+	Lines& lines = m_testLines[test][addFile(fileName)];
+	Lines::iterator it = std::lower_bound(lines.begin(), lines.end(), line);
+	if(it == lines.end() || *it != line)
+		lines.insert(it, line);
+}
+
+unsigned int CoverageIndex::testCount() const
+{
+	return m_testNames.size();
+}
+
+const std::string& CoverageIndex::testName(unsigned int test) const
+{
+	return m_testNames[test];
+}
+
+int CoverageIndex::findTest(const std::string& name) const
+{
+	Indexes::const_iterator it = m_testIndexes.find(name);
+	return it == m_testIndexes.end() ? -1 : (int)it->second;
+}
+
+unsigned int CoverageIndex::fileCount() const
+{
+	return m_fileNames.size();
+}
+
+const std::string& CoverageIndex::fileName(unsigned int file) const
+{
+	return m_fileNames[file];
+}
+
+int CoverageIndex::findFile(const std::string& fileName) const
+{
+	Indexes::const_iterator it = m_fileIndexes.find(fileName);
+	return it == m_fileIndexes.end() ? -1 : (int)it->second;
+}
+
+const CoverageIndex::Lines& CoverageIndex::lines(unsigned int test, unsigned int file) const
+{
+	FileLines::const_iterator it = m_testLines[test].find(file);
+	return it == m_testLines[test].end() ? m_noLines : it->second;
+}
+
+bool CoverageIndex::covers(unsigned int test, unsigned int file, unsigned int first, unsigned int last) const
+{
+	const Lines& covered = lines(test, file);
+	Lines::const_iterator it = std::lower_bound(covered.begin(), covered.end(), first);
+	return it != covered.end() && *it <= last;
+}
+
+bool CoverageIndex::read(const std::string& fileName)
+{
+	clear();
+
+	std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+	std::string line;
+	if(! std::getline(stream, line) || line != indexHeader)
+		return false;
+
+	// The files are numbered in the order they are listed.
+	CppUnitVector<unsigned int> files;
+	int test = -1;
+	while(std::getline(stream, line))
+	{
+		std::string::size_type separator = line.find('\t');
+		if(separator == std::string::npos)
+			continue;
+
+		std::string kind = line.substr(0, separator);
+		std::string value = line.substr(separator + 1);
+		if(kind == "test")
+		{
+			test = addTest(value);
+			continue;
+		}
+
+		separator = value.find('\t');
+		if(separator == std::string::npos)
+			continue;
+		unsigned long number = ::strtoul(value.c_str(), NULL, 10);
+		value = value.substr(separator + 1);
+
+		if(kind == "file")
+		{
+			if(number >= files.size())
+				files.resize(number + 1, 0);
+			files[number] = addFile(value);
+		}
+		else if(kind == "lines" && test >= 0 && number < files.size())
+		{
+			Lines& lines = m_testLines[test][files[number]];
+			const char* ranges = value.c_str();
+			while(*ranges != '\0')
+			{
+				char* end = NULL;
+				unsigned long first = ::strtoul(ranges, &end, 10);
+				unsigned long last = first;
+				if(*end == '-')
+					last = ::strtoul(end + 1, &end, 10);
+				for(unsigned long covered = first; covered <= last; ++covered)
+					lines.push_back(covered);
+				ranges = *end == ',' ? end + 1 : end;
+				if(end == ranges && *end != '\0')
+					break;
+			}
+			std::sort(lines.begin(), lines.end());
+			lines.erase(std::unique(lines.begin(), lines.end()), lines.end());
+		}
+	}
+	return true;
+}
+
+void CoverageIndex::write(const std::string& fileName) const
+{
+	std::ostringstream text;
+	text << indexHeader << '\n';
+	for(unsigned int file = 0; file < m_fileNames.size(); ++file)
+		text << "file\t" << file << '\t' << m_fileNames[file] << '\n';
+
+	for(unsigned int test = 0; test < m_testNames.size(); ++test)
+	{
+		text << "test\t" << m_testNames[test] << '\n';
+		for(FileLines::const_iterator it = m_testLines[test].begin(); it != m_testLines[test].end(); ++it)
+		{
+			const Lines& lines = it->second;
+			if(lines.empty())
+				continue;
+
+			text << "lines\t" << it->first << '\t';
+			for(unsigned int index = 0; index < lines.size(); )
+			{
+				unsigned int last = index;
+				while(last + 1 < lines.size() && lines[last + 1] == lines[last] + 1)
+					++last;
+				if(index > 0)
+					text << ',';
+				text << lines[index];
+				if(last > index)
+					text << '-' << lines[last];
+				index = last + 1;
+			}
+			text << '\n';
+		}
+	}
+
+	std::ofstream stream(fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+	std::string content = text.str();
+	stream.write(content.data(), content.length());
+	if(! stream)
+		throw std::runtime_error("CoverageIndex: failed to write <" + fileName + ">");
+}
+
+void CoverageIndex::clear()
+{
+	m_testNames.clear();
+	m_testLines.clear();
+	m_testIndexes.clear();
+	m_fileNames.clear();
+	m_fileIndexes.clear();
+}
+
+unsigned int CoverageIndex::addFile(const std::string& fileName)
+{
+	Indexes::iterator it = m_fileIndexes.find(fileName);
+	if(it != m_fileIndexes.end())
+		return it->second;
+
+	unsigned int file = m_fileNames.size();
+	m_fileIndexes.insert(std::pair<const std::string, unsigned int>(fileName, file));
+	m_fileNames.push_back(fileName);
+	return file;
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,93 @@
+#include <cppunit/CoverageListener.h>
+#include <cppunit/CoverageIndex.h>
+#include <cppunit/Test.h>
+#include <algorithm>
+#include <stdexcept>
+#include <stdlib.h>
+
+
+namespace
+{
+	/// Installed by the cppunit_coverage library, if it is linked.
+	const CPPUNIT_NS::CoverageListener::Recorder* recorder = NULL;
+}
+
+
+CPPUNIT_NS_BEGIN
+
+
+CoverageListener::CoverageListener(const std::string& fileName)
+	: m_fileName(fileName)
+	, m_tests()
+{
+}
+
+CoverageListener::~CoverageListener()
+{
+	if(recorder)
+		recorder->stop(NULL);
+}
+
+void CoverageListener::startTest(Test*)
+{
+	if(recorder)
+		recorder->start();
+}
+
+void CoverageListener::endTest(Test* test)
+{
+	size_t count = 0;
+	size_t* addresses = recorder ? recorder->stop(&count) : NULL;
+
+	m_tests.push_back(TestAddresses());
+	m_tests.back().name = test->getScopedName();
+	if(addresses)
+	{
+		m_tests.back().addresses.assign(addresses, addresses + count);
+		std::sort(m_tests.back().addresses.begin(), m_tests.back().addresses.end());
+		::free(addresses);
+	}
+}
+
+void CoverageListener::write()
+{
+	if(! isInstrumented())
+		throw std::runtime_error("CoverageListener: no instrumented code was run, compile it with -fsanitize-coverage=trace-pc and link cppunit_coverage");
+
+	Addresses addresses;
+	for(CppUnitVector<TestAddresses>::const_iterator it = m_tests.begin(); it != m_tests.end(); ++it)
+		addresses.insert(addresses.end(), it->addresses.begin(), it->addresses.end());
+	std::sort(addresses.begin(), addresses.end());
+	addresses.erase(std::unique(addresses.begin(), addresses.end()), addresses.end());
+
+	CppUnitVector<SourceLine> lines;
+	if(! doMapLines(addresses, lines))
+		throw std::runtime_error("CoverageListener: failed to map the code addresses to source lines");
+
+	CoverageIndex index;
+	index.read(m_fileName);
+	for(CppUnitVector<TestAddresses>::const_iterator it = m_tests.begin(); it != m_tests.end(); ++it)
+	{
+		unsigned int test = index.addTest(it->name);
+		for(Addresses::const_iterator address = it->addresses.begin(); address != it->addresses.end(); ++address)
+		{
+			const SourceLine& line = lines[std::lower_bound(addresses.begin(), addresses.end(), *address) - addresses.begin()];
+			if(line.isValid())
+				index.addLine(test, line.fileName(), line.lineNumber());
+		}
+	}
+	index.write(m_fileName);
+}
+
+bool CoverageListener::isInstrumented()
+{
+	return recorder && recorder->isInstrumented();
+}
+
+void CoverageListener::setRecorder(const Recorder* newRecorder)
+{
+	recorder = newRecorder;
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,212 @@
+#include <cppunit/CoverageListener.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// Callbacks of the -fsanitize-coverage=trace-pc and trace-pc-guard
+// instrumentations, in the cppunit_coverage library: only the instrumented
+// test binaries link it, as they would override the callbacks of the
+// sanitizers (ASan, libFuzzer...).
+//
+// The callbacks run for every basic block of the code under test, which may
+// be compiled with the same inline functions and templates as this file. They
+// must not call any code that could be instrumented, so they only use C
+// functions and plain arrays, and are not instrumented themselves.
+#if defined(__clang__)
+#   define CPPUNIT_NO_COVERAGE __attribute__((no_sanitize("coverage")))
+#elif defined(__GNUC__) && __GNUC__ >= 12
+#   define CPPUNIT_NO_COVERAGE __attribute__((no_sanitize_coverage))
+#else
+#   define CPPUNIT_NO_COVERAGE
+#endif
+
+namespace
+{
+	// Addresses reached by the running test: open addressing hash set.
+	size_t* coveredAddresses = NULL;
+	size_t  coveredCapacity = 0;
+	size_t  coveredCount = 0;
+
+	// trace-pc-guard guards disabled during the running test.
+	unsigned int** hitGuards = NULL;
+	size_t         hitGuardCapacity = 0;
+	size_t         hitGuardCount = 0;
+
+	volatile bool recording = false;
+	volatile bool instrumented = false;
+	volatile int  lock = 0;
+
+	CPPUNIT_NO_COVERAGE void acquire()
+	{
+#if defined(__GNUC__)
+		while(__sync_lock_test_and_set(&lock, 1))
+		{
+			while(lock)
+				;
+		}
+#endif
+	}
+
+	CPPUNIT_NO_COVERAGE void release()
+	{
+#if defined(__GNUC__)
+		__sync_lock_release(&lock);
+#endif
+	}
+
+	CPPUNIT_NO_COVERAGE size_t slotOf(size_t address, size_t capacity)
+	{
+		return (address * 2654435761u) & (capacity - 1);
+	}
+
+	CPPUNIT_NO_COVERAGE void insertAddress(size_t address)
+	{
+		if((coveredCount + 1) * 2 > coveredCapacity)
+		{
+			size_t capacity = coveredCapacity ? coveredCapacity * 2 : 4096;
+			size_t* addresses = (size_t*)::calloc(capacity, sizeof(size_t));
+			if(! addresses)
+				return;
+			for(size_t index = 0; index < coveredCapacity; ++index)
+			{
+				if(coveredAddresses[index] == 0)
+					continue;
+				size_t slot = slotOf(coveredAddresses[index], capacity);
+				while(addresses[slot] != 0)
+					slot = (slot + 1) & (capacity - 1);
+				addresses[slot] = coveredAddresses[index];
+			}
+			::free(coveredAddresses);
+			coveredAddresses = addresses;
+			coveredCapacity = capacity;
+		}
+
+		size_t slot = slotOf(address, coveredCapacity);
+		while(coveredAddresses[slot] != 0)
+		{
+			if(coveredAddresses[slot] == address)
+				return;
+			slot = (slot + 1) & (coveredCapacity - 1);
+		}
+		coveredAddresses[slot] = address;
+		++coveredCount;
+	}
+
+	CPPUNIT_NO_COVERAGE void recordAddress(void* address)
+	{
+		instrumented = true;
+		if(! recording)
+			return;
+
+		acquire();
+		if(recording)
+			insertAddress((size_t)address);
+		release();
+	}
+
+	CPPUNIT_NO_COVERAGE void recordGuard(unsigned int* guard, void* address)
+	{
+		instrumented = true;
+		if(! recording || *guard == 0)
+			return;
+
+		acquire();
+		if(recording && *guard != 0)
+		{
+			if(hitGuardCount == hitGuardCapacity)
+			{
+				size_t capacity = hitGuardCapacity ? hitGuardCapacity * 2 : 4096;
+				unsigned int** guards = (unsigned int**)::realloc(hitGuards, capacity * sizeof(unsigned int*));
+				if(guards)
+				{
+					hitGuards = guards;
+					hitGuardCapacity = capacity;
+				}
+			}
+			if(hitGuardCount < hitGuardCapacity)
+			{
+				hitGuards[hitGuardCount++] = guard;
+				*guard = 0;
+			}
+			insertAddress((size_t)address);
+		}
+		release();
+	}
+
+	void start()
+	{
+		acquire();
+		if(coveredAddresses)
+			::memset(coveredAddresses, 0, coveredCapacity * sizeof(size_t));
+		coveredCount = 0;
+		recording = true;
+		release();
+	}
+
+	size_t* stop(size_t* count)
+	{
+		acquire();
+		recording = false;
+
+		// Copies the addresses before releasing the lock: the copy is made by
+		// code that may be instrumented.
+		size_t* addresses = NULL;
+		if(count)
+		{
+			addresses = (size_t*)::malloc((coveredCount ? coveredCount : 1) * sizeof(size_t));
+			*count = 0;
+			for(size_t index = 0; addresses && index < coveredCapacity; ++index)
+			{
+				if(coveredAddresses[index] != 0)
+					addresses[(*count)++] = coveredAddresses[index];
+			}
+		}
+
+		for(size_t index = 0; index < hitGuardCount; ++index)
+			*hitGuards[index] = 1;
+		hitGuardCount = 0;
+		release();
+		return addresses;
+	}
+
+	bool isInstrumented()
+	{
+		return instrumented;
+	}
+
+	const CPPUNIT_NS::CoverageListener::Recorder recorder = { &start, &stop, &isInstrumented };
+
+	/// Installs the recorder when this file is linked, which the callbacks ensure.
+	struct RecorderInstaller
+	{
+		RecorderInstaller()
+		{
+			CPPUNIT_NS::CoverageListener::setRecorder(&recorder);
+		}
+	} installer;
+}
+
+
+#if defined(__GNUC__)
+
+extern "C"
+{
+	CPPUNIT_NO_COVERAGE void __sanitizer_cov_trace_pc()
+	{
+		recordAddress(__builtin_return_address(0));
+	}
+
+	CPPUNIT_NO_COVERAGE void __sanitizer_cov_trace_pc_guard_init(unsigned int* start, unsigned int* stop)
+	{
+		// Guards are enabled while they are not zero.
+		for(unsigned int* guard = start; guard < stop; ++guard)
+			*guard = 1;
+	}
+
+	CPPUNIT_NO_COVERAGE void __sanitizer_cov_trace_pc_guard(unsigned int* guard)
+	{
+		recordGuard(guard, __builtin_return_address(0));
+	}
+}
+
+#endif
@@ -6,9 +6,11 @@
 CPPUNIT_NS_BEGIN
 
 
-DynamicLibraryManager::DynamicLibraryManager( const std::string &libraryFileName )
+DynamicLibraryManager::DynamicLibraryManager( const std::string &libraryFileName,
+                                              int flags )
     : m_libraryHandle( NULL )
     , m_libraryName( libraryFileName )
+    , m_flags( flags )
 {
   loadLibrary( libraryFileName );
 }
@@ -40,6 +42,13 @@ DynamicLibraryManager::findSymbol( const std::string &symbol )
 }
 
 
+const void *
+DynamicLibraryManager::findLibraryBase( const void *address )
+{
+  return doFindLibraryBase( address );
+}
+
+
 void
 DynamicLibraryManager::loadLibrary( const std::string &libraryName )
 {
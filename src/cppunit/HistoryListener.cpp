@@ -0,0 +1,63 @@
+#include <cppunit/HistoryListener.h>
+#include <cppunit/Test.h>
+#include <cppunit/TestFailure.h>
+#include <cppunit/tools/Clock.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+HistoryListener::HistoryListener(const std::string& directory)
+	: m_history(directory, true)
+	, m_runId(0)
+	, m_hasRun(false)
+	, m_rows()
+	, m_row()
+	, m_startTime(0)
+	, m_startUsage()
+{
+}
+
+HistoryListener::~HistoryListener()
+{
+}
+
+void HistoryListener::startTest(Test* test)
+{
+	m_row.testId = m_history.addTest(test->getScopedName());
+	m_row.status = TestRecord::success;
+	m_startUsage = ResourceUsage::current();
+	m_startTime = Clock::microseconds();
+}
+
+void HistoryListener::addFailure(const TestFailure& failure)
+{
+	if(failure.isError())
+		m_row.status = TestRecord::error;
+	else if(m_row.status == TestRecord::success)
+		m_row.status = TestRecord::failure;
+}
+
+void HistoryListener::endTest(Test*)
+{
+	m_row.duration = Clock::microseconds() - m_startTime;
+
+	ResourceUsage usage = ResourceUsage::current();
+	m_row.cpuTime = usage.cpuTime - m_startUsage.cpuTime;
+	m_row.peakMemory = usage.peakMemory;
+	m_rows.push_back(m_row);
+}
+
+void HistoryListener::endTestRun(Test*, TestResult*)
+{
+	if(! m_hasRun)
+	{
+		m_runId = m_history.addRun();
+		m_hasRun = true;
+	}
+	m_history.addRows(m_runId, m_rows);
+	m_rows.clear();
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,83 @@
+#include <cppunit/Exception.h>
+#include <cppunit/JournalListener.h>
+#include <cppunit/Message.h>
+#include <cppunit/Test.h>
+#include <cppunit/TestFailure.h>
+#include <cppunit/tools/Clock.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+JournalListener::JournalListener(const std::string& fileName, bool resume)
+	: m_journal(fileName, resume)
+	, m_status(TestRecord::success)
+	, m_startTime(0)
+{
+}
+
+JournalListener::~JournalListener()
+{
+}
+
+void JournalListener::replay(Test* root, TestListener* listener) const
+{
+	int childCount = root->getChildTestCount();
+	for(int index = 0; index < childCount; ++index)
+		replay(root->getChildTestAt(index), listener);
+
+	if(childCount > 0)
+		return;
+
+	const TestJournal::Record* record = m_journal.find(root->getScopedName());
+	if(record == NULL)
+		return;
+
+	listener->startTest(root);
+	if(record->status == TestRecord::running)
+	{
+		Message message("test did not complete", "the process terminated while running the test");
+		TestFailure failure(root, new Exception(message), true);
+		listener->addFailure(failure);
+	}
+	else if(record->isFailure())
+	{
+		TestFailure failure(root, record->makeException(), record->status == TestRecord::error);
+		listener->addFailure(failure);
+	}
+	listener->endTest(root);
+}
+
+bool JournalListener::accept(Test* test) const
+{
+	return m_journal.find(test->getScopedName()) == NULL;
+}
+
+void JournalListener::startTest(Test* test)
+{
+	m_status = TestRecord::success;
+	m_journal.startTest(test->getScopedName());
+	m_startTime = Clock::microseconds();
+}
+
+void JournalListener::addFailure(const TestFailure& failure)
+{
+	if(failure.isError())
+		m_status = TestRecord::error;
+	else if(m_status == TestRecord::success)
+		m_status = TestRecord::failure;
+	m_journal.addFailure(failure);
+}
+
+void JournalListener::endTest(Test*)
+{
+	m_journal.endTest(m_status, Clock::microseconds() - m_startTime);
+}
+
+void JournalListener::endTestRun(Test*, TestResult*)
+{
+	m_journal.flush();
+}
+
+
+CPPUNIT_NS_END
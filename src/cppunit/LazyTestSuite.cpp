@@ -0,0 +1,146 @@
+#include <cppunit/extensions/LazyTestSuite.h>
+#include <cppunit/extensions/TestFactory.h>
+#include <cppunit/Protector.h>
+#include <cppunit/TestResult.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+namespace
+{
+	/// Makes the test of a LazyTestSuite.
+	class MakeTestFunctor : public Functor
+	{
+	public:
+		MakeTestFunctor(const LazyTestSuite* suite)
+			: m_suite(suite)
+		{
+		}
+
+		bool operator()() const
+		{
+			m_suite->getTest();
+			return true;
+		}
+
+	private:
+		const LazyTestSuite* m_suite;
+	};
+}
+
+
+LazyTestSuite::LazyTestSuite(const std::string& name, TestFactory* factory)
+	: m_name(name)
+	, m_factory(factory)
+	, m_test(NULL)
+	, m_description(NULL)
+	, m_isDescribed(false)
+{
+}
+
+LazyTestSuite::~LazyTestSuite()
+{
+	delete m_test;
+	delete m_description;
+}
+
+void LazyTestSuite::run(TestResult* result)
+{
+	if(result->shouldRun(this) && make(result))
+		m_test->run(result);
+}
+
+bool LazyTestSuite::make(TestResult* result)
+{
+	if(m_test)
+		return true;
+
+	try
+	{
+		getTest();
+		return true;
+	}
+	catch(...)
+	{
+	}
+
+	// Made again under the protectors, reported as a test of its own so that
+	// every listener records the error.
+	result->startTest(this);
+	bool isMade = result->protect(MakeTestFunctor(this), this, "failed to make the suite");
+	result->endTest(this);
+	return isMade;
+}
+
+int LazyTestSuite::countTestCases() const
+{
+	Test* description = getDescription();
+	return (description ? description : getTest())->countTestCases();
+}
+
+int LazyTestSuite::getChildTestCount() const
+{
+	return getTest()->getChildTestCount();
+}
+
+Test* LazyTestSuite::doGetChildTestAt(int index) const
+{
+	return getTest()->getChildTestAt(index);
+}
+
+std::string LazyTestSuite::getName() const
+{
+	return m_name;
+}
+
+std::string LazyTestSuite::getScopedName() const
+{
+	return m_name;
+}
+
+std::string LazyTestSuite::getTestNamePrefix() const
+{
+	return m_name + "::";
+}
+
+std::string LazyTestSuite::getProperty(const std::string& key) const
+{
+	Test* description = getDescription();
+	return description ? description->getProperty(key) : std::string();
+}
+
+Test* LazyTestSuite::getDescription() const
+{
+	if(m_test)
+		return m_test;
+
+	if(! m_isDescribed)
+	{
+		m_isDescribed = true;
+		try
+		{
+			m_description = m_factory->makeDescription();
+		}
+		catch(...)
+		{
+			// Made instead, which reports the error.
+		}
+	}
+	return m_description;
+}
+
+bool LazyTestSuite::isMade() const
+{
+	return m_test != NULL;
+}
+
+Test* LazyTestSuite::getTest() const
+{
+	if(! m_test)
+		m_test = m_factory->makeTest();
+	return m_test;
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,80 @@
+#include <cppunit/tools/LocalSocket.h>
+#include <stdexcept>
+
+
+CPPUNIT_NS_BEGIN
+
+
+LocalSocket::LocalSocket(const std::string& path)
+	: m_path(path)
+	, m_buffer()
+	, m_listener(-1)
+	, m_connection(-1)
+{
+	if(! doListen())
+	{
+		doClose();
+		throw std::runtime_error("LocalSocket: failed to listen to <" + path + ">");
+	}
+}
+
+LocalSocket::~LocalSocket()
+{
+	doDisconnect();
+	doClose();
+}
+
+const std::string& LocalSocket::path() const
+{
+	return m_path;
+}
+
+bool LocalSocket::accept()
+{
+	disconnect();
+	return doAccept();
+}
+
+bool LocalSocket::readLine(std::string& line)
+{
+	std::string::size_type end = m_buffer.find('\n');
+	while(end == std::string::npos)
+	{
+		char data[4096];
+		long size = m_connection < 0 ? -1 : doRead(data, sizeof(data));
+		if(size <= 0)
+			return false;
+		m_buffer.append(data, size);
+		end = m_buffer.find('\n', m_buffer.length() - size);
+	}
+
+	line = m_buffer.substr(0, end);
+	if(! line.empty() && line[line.length() - 1] == '\r')
+		line.erase(line.length() - 1);
+	m_buffer.erase(0, end + 1);
+	return true;
+}
+
+bool LocalSocket::write(const std::string& text)
+{
+	if(m_connection < 0)
+		return false;
+	if(doWrite(text.data(), text.length()))
+		return true;
+	disconnect();
+	return false;
+}
+
+void LocalSocket::disconnect()
+{
+	doDisconnect();
+	m_buffer.clear();
+}
+
+bool LocalSocket::isConnected() const
+{
+	return m_connection >= 0;
+}
+
+
+CPPUNIT_NS_END
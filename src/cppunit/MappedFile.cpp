@@ -0,0 +1,66 @@
+#include <cppunit/tools/MappedFile.h>
+#include <stdexcept>
+
+
+CPPUNIT_NS_BEGIN
+
+
+MappedFile::MappedFile(const std::string& fileName, bool writable)
+	: m_fileName(fileName)
+	, m_writable(writable)
+	, m_data(NULL)
+	, m_size(0)
+	, m_file(NULL)
+	, m_mapping(NULL)
+{
+	if(! doOpen())
+		throwError("open");
+	if(! doMap())
+	{
+		doClose();
+		throwError("map");
+	}
+}
+
+MappedFile::~MappedFile()
+{
+	doUnmap();
+	doClose();
+}
+
+char* MappedFile::data() const
+{
+	return m_data;
+}
+
+size_t MappedFile::size() const
+{
+	return m_size;
+}
+
+void MappedFile::resize(size_t size)
+{
+	doUnmap();
+	if(! doResize(size))
+	{
+		doMap();
+		throwError("resize");
+	}
+	m_size = size;
+	if(! doMap())
+		throwError("map");
+}
+
+void MappedFile::flush()
+{
+	if(m_data != NULL && m_writable)
+		doFlush();
+}
+
+void MappedFile::throwError(const std::string& operation)
+{
+	throw std::runtime_error("MappedFile: failed to " + operation + " <" + m_fileName + ">");
+}
+
+
+CPPUNIT_NS_END
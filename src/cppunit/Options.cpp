@@ -1,4 +1,6 @@
 #include "Options.h"
+#include <cerrno>
+#include <climits>
 #include <cstdlib>
 
 CPPUNIT_NS::Options::Options(std::ostream& out, std::ostream& error)
@@ -9,7 +11,27 @@ CPPUNIT_NS::Options::Options(std::ostream& out, std::ostream& error)
 	, _doPrintResult(true)
 	, _doPrintProgress(true)
 	, _doPrintVerbose(false)
+	, _doListTests(false)
+	, _doListJson(false)
 	, _doXmlOutput(false)
+	, _binaryOutputFile()
+	, _historyDirectory()
+	, _compareWithFile()
+	, _slowdownThreshold(20)
+	, _doFailOnSlowdown(false)
+	, _journalFile()
+	, _doResume(false)
+	, _doFastExit(false)
+	, _doCaptureOutput(false)
+	, _captureLimit(64 * 1024)
+	, _serveSocket()
+	, _coverageFile()
+	, _changedIndexFile()
+	, _cacheDirectory()
+	, _testOrder()
+	, _orderFile("cppunit-order.txt")
+	, _doFailFast(false)
+	, _timeBudget(0)
 {}
 
 void CPPUNIT_NS::Options::parse(int argc, const char* argv[])
@@ -40,10 +62,99 @@ void CPPUNIT_NS::Options::parse(int argc, const char* argv[])
 		{
 			_doPrintProgress = false;
 		}
+		else if(option == "-f" || option == "--filter")
+		{
+			_testFilters.push_back(optionValue(argc, argv, i));
+		}
+		else if(option == "-l" || option == "--list-tests")
+		{
+			_doListTests = true;
+		}
+		else if(option == "--list-tests-json")
+		{
+			_doListTests = true;
+			_doListJson = true;
+		}
 		else if(option == "-x" || option == "--xml-output")
 		{
 			_doXmlOutput = true;
 		}
+		else if(option == "-b" || option == "--binary-output")
+		{
+			_binaryOutputFile = optionValue(argc, argv, i);
+		}
+		else if(option == "--history")
+		{
+			_historyDirectory = optionValue(argc, argv, i);
+		}
+		else if(option == "--compare-with")
+		{
+			_compareWithFile = optionValue(argc, argv, i);
+		}
+		else if(option == "--slowdown")
+		{
+			_slowdownThreshold = numberValue(argc, argv, i);
+		}
+		else if(option == "--fail-on-slowdown")
+		{
+			_doFailOnSlowdown = true;
+		}
+		else if(option == "-j" || option == "--journal")
+		{
+			_journalFile = optionValue(argc, argv, i);
+		}
+		else if(option == "--resume")
+		{
+			_journalFile = optionValue(argc, argv, i);
+			_doResume = true;
+		}
+		else if(option == "--fast-exit")
+		{
+			_doFastExit = true;
+		}
+		else if(option == "-c" || option == "--capture-output")
+		{
+			_doCaptureOutput = true;
+		}
+		else if(option == "--capture-limit")
+		{
+			_captureLimit = numberValue(argc, argv, i);
+			_doCaptureOutput = true;
+		}
+		else if(option == "--serve")
+		{
+			_serveSocket = optionValue(argc, argv, i);
+		}
+		else if(option == "--coverage")
+		{
+			_coverageFile = optionValue(argc, argv, i);
+		}
+		else if(option == "--changed")
+		{
+			_changedIndexFile = optionValue(argc, argv, i);
+		}
+		else if(option == "--cache-dir")
+		{
+			_cacheDirectory = optionValue(argc, argv, i);
+		}
+		else if(option == "--order")
+		{
+			_testOrder = optionValue(argc, argv, i);
+			if(_testOrder != "failed-first" && _testOrder != "likely-fail")
+				exitErrorMessage(option + " " + _testOrder, "invalid value for option");
+		}
+		else if(option == "--order-file")
+		{
+			_orderFile = optionValue(argc, argv, i);
+		}
+		else if(option == "--fail-fast")
+		{
+			_doFailFast = true;
+		}
+		else if(option == "--time-budget")
+		{
+			_timeBudget = secondsValue(argc, argv, i);
+		}
 		else if(option == "-v" || option == "--version")
 		{
 			exitVersionMessage();
@@ -68,6 +179,11 @@ const std::vector<std::string>& CPPUNIT_NS::Options::testNames() const
 	return _testNames;
 }
 
+const std::vector<std::string>& CPPUNIT_NS::Options::testFilters() const
+{
+	return _testFilters;
+}
+
 bool CPPUNIT_NS::Options::doWait() const
 {
 	return _doWait;
@@ -88,11 +204,157 @@ bool CPPUNIT_NS::Options::doPrintVerbose() const
 	return _doPrintVerbose;
 }
 
+bool CPPUNIT_NS::Options::doListTests() const
+{
+	return _doListTests;
+}
+
+bool CPPUNIT_NS::Options::doListJson() const
+{
+	return _doListJson;
+}
+
 bool CPPUNIT_NS::Options::doXmlOutput() const
 {
 	return _doXmlOutput;
 }
 
+const std::string& CPPUNIT_NS::Options::binaryOutputFile() const
+{
+	return _binaryOutputFile;
+}
+
+const std::string& CPPUNIT_NS::Options::historyDirectory() const
+{
+	return _historyDirectory;
+}
+
+const std::string& CPPUNIT_NS::Options::compareWithFile() const
+{
+	return _compareWithFile;
+}
+
+unsigned int CPPUNIT_NS::Options::slowdownThreshold() const
+{
+	return _slowdownThreshold;
+}
+
+bool CPPUNIT_NS::Options::doFailOnSlowdown() const
+{
+	return _doFailOnSlowdown;
+}
+
+const std::string& CPPUNIT_NS::Options::journalFile() const
+{
+	return _journalFile;
+}
+
+bool CPPUNIT_NS::Options::doResume() const
+{
+	return _doResume;
+}
+
+bool CPPUNIT_NS::Options::doFastExit() const
+{
+	return _doFastExit;
+}
+
+bool CPPUNIT_NS::Options::doCaptureOutput() const
+{
+	return _doCaptureOutput;
+}
+
+size_t CPPUNIT_NS::Options::captureLimit() const
+{
+	return _captureLimit;
+}
+
+const std::string& CPPUNIT_NS::Options::serveSocket() const
+{
+	return _serveSocket;
+}
+
+const std::string& CPPUNIT_NS::Options::coverageFile() const
+{
+	return _coverageFile;
+}
+
+const std::string& CPPUNIT_NS::Options::changedIndexFile() const
+{
+	return _changedIndexFile;
+}
+
+const std::string& CPPUNIT_NS::Options::cacheDirectory() const
+{
+	return _cacheDirectory;
+}
+
+const std::string& CPPUNIT_NS::Options::testOrder() const
+{
+	return _testOrder;
+}
+
+const std::string& CPPUNIT_NS::Options::orderFile() const
+{
+	return _orderFile;
+}
+
+bool CPPUNIT_NS::Options::doFailFast() const
+{
+	return _doFailFast;
+}
+
+unsigned long CPPUNIT_NS::Options::timeBudget() const
+{
+	return _timeBudget;
+}
+
+std::string CPPUNIT_NS::Options::optionValue(int argc, const char* argv[], int& index)
+{
+	if(index + 1 >= argc)
+		exitErrorMessage(argv[index], "missing value for option");
+	return argv[++index];
+}
+
+unsigned long CPPUNIT_NS::Options::numberValue(int argc, const char* argv[], int& index)
+{
+	std::string option = argv[index];
+	std::string value = optionValue(argc, argv, index);
+
+	char* end = NULL;
+	unsigned long number = ::strtoul(value.c_str(), &end, 10);
+	if(value.empty() || *end != '\0' || value[0] == '-')
+		exitErrorMessage(option + " " + value, "invalid value for option");
+	return number;
+}
+
+unsigned long CPPUNIT_NS::Options::secondsValue(int argc, const char* argv[], int& index)
+{
+	std::string option = argv[index];
+	std::string value = optionValue(argc, argv, index);
+
+	char* end = NULL;
+	errno = 0;
+	unsigned long number = ::strtoul(value.c_str(), &end, 10);
+	std::string unit = end;
+	if(value.empty() || end == value.c_str() || value[0] == '-')
+		exitErrorMessage(option + " " + value, "invalid value for option");
+
+	unsigned long factor = 1;
+	if(unit == "m")
+		factor = 60;
+	else if(unit == "h")
+		factor = 60 * 60;
+	else if(! unit.empty() && unit != "s")
+		exitErrorMessage(option + " " + value, "invalid value for option");
+
+	// The seconds are later counted in microseconds, which must not overflow either.
+	const unsigned long long maxSeconds = ~0ULL / 1000000;
+	if(number == 0 || errno == ERANGE || number > ULONG_MAX / factor || number * factor > maxSeconds)
+		exitErrorMessage(option + " " + value, "out of range value for option");
+	return number * factor;
+}
+
 void CPPUNIT_NS::Options::exitVersionMessage()
 {
 	_out << _program << ": CppUnit " << CPPUNIT_VERSION << " (" << __DATE__ << ")" << std::endl;
@@ -111,16 +373,38 @@ void CPPUNIT_NS::Options::exitHelpMessage(int code)
 	_out << "  -w --wait               Wait to exit until user presses RETURN" << std::endl;
 	_out << "  -r --no-print-result    Disable printing test result" << std::endl;
 	_out << "  -p --no-print-progress  Disable printing test progress" << std::endl;
+	_out << "  -f --filter PATTERNS    Run tests matching glob or /regex/ PATTERNS (Foo::*:-Foo::testSlow*)" << std::endl;
+	_out << "  -l --list-tests         List the tests with their count, without running them" << std::endl;
+	_out << "     --list-tests-json    List the tests as JSON" << std::endl;
 	_out << "  -x --xml-output         Enable xml output for test result" << std::endl;
+	_out << "  -b --binary-output FILE Write test results to a binary result file" << std::endl;
+	_out << "     --history DIR        Append test results to the history store in DIR" << std::endl;
+	_out << "     --compare-with FILE  Report new failures, fixed and slower tests since FILE" << std::endl;
+	_out << "     --slowdown PERCENT   Duration growth reported as slower, binary FILE only (default 20)" << std::endl;
+	_out << "     --fail-on-slowdown   Fail the run if a test is slower, binary FILE only" << std::endl;
+	_out << "  -j --journal FILE       Record test results in a crash-safe journal" << std::endl;
+	_out << "     --resume FILE        Skip tests finished in journal and merge their results" << std::endl;
+	_out << "     --fast-exit          Exit without destroying the tests once results are written" << std::endl;
+	_out << "  -c --capture-output     Capture test output, print it only for failed tests" << std::endl;
+	_out << "     --capture-limit SIZE Keep at most SIZE bytes of captured output per test" << std::endl;
+	_out << "     --serve SOCKET       Run the tests requested over the local SOCKET until shut down" << std::endl;
+	_out << "     --coverage FILE      Write the lines covered by each test to the index FILE" << std::endl;
+	_out << "     --changed INDEX      Run the tests covering the diff read from stdin, per coverage INDEX" << std::endl;
+	_out << "     --cache-dir DIR      Skip tests that passed in the same build and inputs, cached in DIR" << std::endl;
+	_out << "     --order ORDER        Run failed-first or likely-fail tests first, per the recent outcomes" << std::endl;
+	_out << "     --order-file FILE    Record the recent outcomes in FILE (default cppunit-order.txt)" << std::endl;
+	_out << "     --fail-fast          Stop at the first failure" << std::endl;
+	_out << "     --time-budget TIME   Run the tests most likely to fail per second within TIME (90s, 10m, 1h)," << std::endl;
+	_out << "                          all of them while the order file records no duration" << std::endl;
 
 	_out << std::endl;
 
 	::exit(code);
 }
 
-void CPPUNIT_NS::Options::exitErrorMessage(const std::string& option)
+void CPPUNIT_NS::Options::exitErrorMessage(const std::string& option, const std::string& error)
 {
-	_error << _program << ": invalid option " << option << std::endl;
+	_error << _program << ": " << error << " " << option << std::endl;
 	exitHelpMessage(1);
 }
 
@@ -16,18 +16,52 @@ public:
 	void parse(int argc, const char* argv[]);
 
 	const std::vector<std::string>& testNames() const;
+	const std::vector<std::string>& testFilters() const;
 
 	bool doWait() const;
 	bool doPrintResult() const;
 	bool doPrintProgress() const;
 	bool doPrintVerbose() const;
 
+	bool doListTests() const;
+	bool doListJson() const;
+
 	bool doXmlOutput() const;
+	const std::string& binaryOutputFile() const;
+	const std::string& historyDirectory() const;
+
+	const std::string& compareWithFile() const;
+	unsigned int slowdownThreshold() const;
+	bool doFailOnSlowdown() const;
+
+	const std::string& journalFile() const;
+	bool doResume() const;
+
+	bool doFastExit() const;
+
+	bool doCaptureOutput() const;
+	size_t captureLimit() const;
+
+	const std::string& serveSocket() const;
+
+	const std::string& coverageFile() const;
+	const std::string& changedIndexFile() const;
+
+	const std::string& cacheDirectory() const;
+
+	const std::string& testOrder() const;
+	const std::string& orderFile() const;
+	bool doFailFast() const;
+	unsigned long timeBudget() const;
 
 protected:
 	void exitVersionMessage();
 	void exitHelpMessage(int code = 0);
-	void exitErrorMessage(const std::string& option);
+	void exitErrorMessage(const std::string& option, const std::string& error = "invalid option");
+
+	std::string optionValue(int argc, const char* argv[], int& index);
+	unsigned long numberValue(int argc, const char* argv[], int& index);
+	unsigned long secondsValue(int argc, const char* argv[], int& index);
 
 protected:
 	std::ostream&            _out;
@@ -36,12 +70,41 @@ protected:
 	std::string              _program;
 
 	std::vector<std::string> _testNames;
+	std::vector<std::string> _testFilters;
 	bool                     _doWait;
 	bool                     _doPrintResult;
 	bool                     _doPrintProgress;
 	bool                     _doPrintVerbose;
 
+	bool                     _doListTests;
+	bool                     _doListJson;
+
 	bool                     _doXmlOutput;
+	std::string              _binaryOutputFile;
+	std::string              _historyDirectory;
+
+	std::string              _compareWithFile;
+	unsigned int             _slowdownThreshold;
+	bool                     _doFailOnSlowdown;
+
+	std::string              _journalFile;
+	bool                     _doResume;
+
+	bool                     _doFastExit;
+
+	bool                     _doCaptureOutput;
+	size_t                   _captureLimit;
+
+	std::string              _serveSocket;
+
+	std::string              _coverageFile;
+	std::string              _changedIndexFile;
+
+	std::string              _cacheDirectory;
+	std::string              _testOrder;
+	std::string              _orderFile;
+	bool                     _doFailFast;
+	unsigned long            _timeBudget;
 };
 
 CPPUNIT_NS_END
@@ -0,0 +1,115 @@
+#include <cppunit/tools/OutputCapture.h>
+#include <cppunit/portability/Stream.h>
+#include <algorithm>
+#include <stdexcept>
+#include <stdio.h>
+#include <string.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+OutputCapture::OutputCapture(size_t maxSize)
+	: m_maxSize(maxSize)
+	, m_capturing(false)
+	, m_pipe(NULL)
+	, m_ring(maxSize)
+	, m_ringStart(0)
+	, m_ringLength(0)
+	, m_dropped(0)
+{
+}
+
+OutputCapture::~OutputCapture()
+{
+	if(m_capturing)
+		stop();
+}
+
+void OutputCapture::start()
+{
+	if(m_capturing)
+		return;
+
+	m_ringStart = 0;
+	m_ringLength = 0;
+	m_dropped = 0;
+	flushStreams();
+	if(! doRedirect())
+		throw std::runtime_error("OutputCapture: failed to redirect the output");
+	m_capturing = true;
+}
+
+std::string OutputCapture::stop()
+{
+	if(! m_capturing)
+		return "";
+
+	flushStreams();
+	doRestore();
+	m_capturing = false;
+
+	std::string output;
+	if(m_dropped > 0)
+	{
+		OStringStream marker;
+		marker << "[... " << m_dropped << " bytes truncated ...]\n";
+		output = marker.str();
+	}
+	size_t first = std::min(m_ringLength, m_maxSize - m_ringStart);
+	if(first > 0)
+		output.append(&m_ring[m_ringStart], first);
+	if(m_ringLength > first)
+		output.append(&m_ring[0], m_ringLength - first);
+	return output;
+}
+
+bool OutputCapture::isCapturing() const
+{
+	return m_capturing;
+}
+
+size_t OutputCapture::maxSize() const
+{
+	return m_maxSize;
+}
+
+void OutputCapture::append(const char* data, size_t length)
+{
+	// Only the tail of the data can be kept.
+	if(length > m_maxSize)
+	{
+		m_dropped += length - m_maxSize;
+		data += length - m_maxSize;
+		length = m_maxSize;
+	}
+	if(length == 0)
+		return;
+
+	// Drops the oldest bytes to make room.
+	if(m_ringLength + length > m_maxSize)
+	{
+		size_t overflow = m_ringLength + length - m_maxSize;
+		m_ringStart = (m_ringStart + overflow) % m_maxSize;
+		m_ringLength -= overflow;
+		m_dropped += overflow;
+	}
+
+	size_t end = (m_ringStart + m_ringLength) % m_maxSize;
+	size_t first = std::min(length, m_maxSize - end);
+	::memcpy(&m_ring[end], data, first);
+	if(length > first)
+		::memcpy(&m_ring[0], data + first, length - first);
+	m_ringLength += length;
+}
+
+void OutputCapture::flushStreams()
+{
+	stdCOut().flush();
+	stdCErr().flush();
+	::fflush(stdout);
+	::fflush(stderr);
+}
+
+
+CPPUNIT_NS_END
@@ -1,10 +1,14 @@
 #include <cppunit/config/SourcePrefix.h>
 #include <cppunit/XmlOutputterHook.h>
+#include <algorithm>
 #include <stdint.h>
 
 #if !defined(CPPUNIT_NO_TESTPLUGIN)
+#include <cppunit/Test.h>
+#include <cppunit/TestResult.h>
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/plugin/PlugInManager.h>
+#include <cppunit/plugin/TestManifest.h>
 #include <cppunit/plugin/TestPlugIn.h>
 #include <cppunit/plugin/DynamicLibraryManager.h>
 
@@ -12,6 +16,33 @@
 CPPUNIT_NS_BEGIN
 
 
+/*! \brief (INTERNAL) Initializes a deferred plug-in before making a suite it registered.
+ */
+class PlugInManager::DeferredFactory : public TestFactory
+{
+public:
+  DeferredFactory( PlugInManager *manager,
+                   CppUnitTestPlugIn *plugIn,
+                   TestFactory *factory )
+      : m_manager( manager )
+      , m_plugIn( plugIn )
+      , m_factory( factory )
+  {
+  }
+
+  Test *makeTest()
+  {
+    m_manager->initialize( m_plugIn );
+    return m_factory->makeTest();
+  }
+
+private:
+  PlugInManager *m_manager;
+  CppUnitTestPlugIn *m_plugIn;
+  TestFactory *m_factory;
+};
+
+
 PlugInManager::PlugInManager()
     : m_plugIns()
 {
@@ -27,19 +58,31 @@ PlugInManager::~PlugInManager()
 
 void
 PlugInManager::load( const std::string &libraryFileName,
-                     const PlugInParameters &parameters )
+                     const PlugInParameters &parameters,
+                     int flags )
 {
   PlugInInfo info;
   info.m_fileName = libraryFileName;
-  info.m_manager = new DynamicLibraryManager( libraryFileName );
+  info.m_manager = new DynamicLibraryManager( libraryFileName, 
+                                              flags & (lazyBinding | localSymbols) );
+  info.m_parameters = parameters;
+  info.m_base = NULL;
+  info.m_initialized = false;
 
   TestPlugInSignature plug = (TestPlugInSignature)((uintptr_t)info.m_manager->findSymbol( 
         CPPUNIT_STRINGIZE( CPPUNIT_PLUGIN_EXPORTED_NAME ) ));
   info.m_interface = (*plug)();
+  info.m_base = DynamicLibraryManager::findLibraryBase( (const void *)(uintptr_t)plug );
 
   m_plugIns.push_back( info );
   
-  info.m_interface->initialize( &TestFactoryRegistry::getRegistry(), parameters );
+  if ( (flags & deferInitialize) == 0  ||  info.m_base == NULL )
+  {
+    m_plugIns.back().m_initialized = true;
+    info.m_interface->initialize( &TestFactoryRegistry::getRegistry(), parameters );
+  }
+  else
+    deferFactories( m_plugIns.back() );
 }
 
 
@@ -58,6 +101,120 @@ PlugInManager::unload( const std::string &libraryFileName )
 }
 
 
+bool 
+PlugInManager::readManifest( const std::string &libraryFileName,
+                             TestManifest &manifest )
+{
+  if ( !manifest.read( TestManifest::fileName( libraryFileName ) ) )
+    return false;
+  return !manifest.buildId().empty()  &&  
+         manifest.buildId() == TestManifest::readBuildId( libraryFileName );
+}
+
+
+bool 
+PlugInManager::listTests( const std::string &libraryFileName,
+                          TestManifest &manifest,
+                          const PlugInParameters &parameters,
+                          int flags )
+{
+  TestManifest stale;
+  if ( readManifest( libraryFileName, stale ) )
+  {
+    manifest = stale;
+    return false;
+  }
+
+  bool loaded = false;
+  for ( PlugIns::iterator it = m_plugIns.begin(); it != m_plugIns.end(); ++it )
+    loaded = loaded  ||  (*it).m_fileName == libraryFileName;
+  if ( !loaded )
+    load( libraryFileName, parameters, flags );
+
+  Test *root = TestFactoryRegistry::getRegistry().makeTest();
+  manifest.clear();
+  addTests( libraryFileName, root, manifest );
+  delete root;
+
+  manifest.mergeDurations( stale );
+  return true;
+}
+
+
+void 
+PlugInManager::addTests( const std::string &libraryFileName,
+                         Test *root,
+                         TestManifest &manifest )
+{
+  for ( PlugIns::iterator it = m_plugIns.begin(); it != m_plugIns.end(); ++it )
+  {
+    if ( (*it).m_fileName == libraryFileName  &&  (*it).m_base != NULL )
+    {
+      manifest.setBuildId( TestManifest::readBuildId( libraryFileName ) );
+      CppUnitSet<std::string> suites;
+      getSuiteNames( *it, suites );
+      addTests( (*it).m_base, suites, root, root->getName(), false, manifest );
+      return;
+    }
+  }
+}
+
+
+void 
+PlugInManager::getSuiteNames( const PlugInInfo &plugIn,
+                              CppUnitSet<std::string> &suites )
+{
+  TestFactoryRegistry &registry = TestFactoryRegistry::getRegistry();
+  CppUnitVector<TestFactory *> factories;
+  registry.getFactories( factories );
+  for ( unsigned int index = 0; index < factories.size(); ++index )
+  {
+    TestFactory *factory = factories[index];
+    const void *vtable = *(const void * const *)factory;
+    bool isDeferred = std::find( plugIn.m_deferredFactories.begin(),
+                                 plugIn.m_deferredFactories.end(),
+                                 factory ) != plugIn.m_deferredFactories.end();
+    if ( !isDeferred  &&
+         DynamicLibraryManager::findLibraryBase( vtable ) != plugIn.m_base )
+      continue;
+
+    std::string name = registry.getFactoryName( factory );
+    if ( !name.empty() )
+      suites.insert( name );
+  }
+}
+
+
+void 
+PlugInManager::addTests( const void *base,
+                         const CppUnitSet<std::string> &suites,
+                         Test *test,
+                         const std::string &suite,
+                         bool isPlugInTest,
+                         TestManifest &manifest )
+{
+  // The test cases of a suite made by a factory of the plug-in are all its
+  // own, whichever library defines their class.
+  isPlugInTest = isPlugInTest  ||  suites.count( test->getName() ) > 0;
+
+  int count = test->getChildTestCount();
+  if ( count == 0 )
+  {
+    // The virtual table of a test lives in the library that defines its class.
+    if ( isPlugInTest  ||
+         DynamicLibraryManager::findLibraryBase( *(const void * const *)test ) == base )
+      manifest.addTest( suite, test->getScopedName() );
+    return;
+  }
+
+  for ( int index = 0; index < count; ++index )
+  {
+    addTests( base, suites, test->getChildTestAt( index ), test->getName(),
+              isPlugInTest, manifest );
+  }
+}
+
+
 void 
 PlugInManager::addListener( TestResult *eventManager )
 {
@@ -79,7 +236,9 @@ PlugInManager::unload( PlugInInfo &plugIn )
 {
   try
   {
-    plugIn.m_interface->uninitialize( &TestFactoryRegistry::getRegistry() );
+    if ( plugIn.m_initialized )
+      plugIn.m_interface->uninitialize( &TestFactoryRegistry::getRegistry() );
+    unregisterFactories( plugIn );
     delete plugIn.m_manager;
   }
   catch (...)
@@ -91,6 +250,80 @@ PlugInManager::unload( PlugInInfo &plugIn )
 }
 
 
+void 
+PlugInManager::unregisterFactories( PlugInInfo &plugIn )
+{
+  bool isRegistryValid = TestFactoryRegistry::isValid();
+  for ( unsigned int index = 0; index < plugIn.m_deferredFactories.size(); ++index )
+  {
+    if ( isRegistryValid )
+      TestFactoryRegistry::getRegistry().unregisterFactory( plugIn.m_deferredFactories[index] );
+    delete plugIn.m_deferredFactories[index];
+  }
+  plugIn.m_deferredFactories.clear();
+
+  // The library may stay loaded after being released, for example if it
+  // defines STB_GNU_UNIQUE symbols: its static registrations are then not
+  // undone by the destructors.
+  if ( plugIn.m_base == NULL  ||  !isRegistryValid )
+    return;
+
+  TestFactoryRegistry &registry = TestFactoryRegistry::getRegistry();
+  CppUnitVector<TestFactory *> factories;
+  registry.getFactories( factories );
+  for ( unsigned int index = 0; index < factories.size(); ++index )
+  {
+    const void *vtable = *(const void * const *)factories[index];
+    if ( DynamicLibraryManager::findLibraryBase( vtable ) == plugIn.m_base )
+      registry.unregisterFactory( factories[index] );
+  }
+}
+
+
+void 
+PlugInManager::deferFactories( PlugInInfo &plugIn )
+{
+  // The factories are replaced under the same name, so that their suites are
+  // still made only when needed.
+  TestFactoryRegistry &registry = TestFactoryRegistry::getRegistry();
+  CppUnitVector<TestFactory *> factories;
+  registry.getFactories( factories );
+  for ( unsigned int index = 0; index < factories.size(); ++index )
+  {
+    TestFactory *factory = factories[index];
+    const void *vtable = *(const void * const *)factory;
+    if ( DynamicLibraryManager::findLibraryBase( vtable ) != plugIn.m_base )
+      continue;
+
+    TestFactory *deferred = new DeferredFactory( this, plugIn.m_interface, factory );
+    plugIn.m_deferredFactories.push_back( deferred );
+    std::string name = registry.getFactoryName( factory );
+    registry.unregisterFactory( factory );
+    if ( name.empty() )
+      registry.registerFactory( deferred );
+    else
+      registry.registerFactory( name, deferred );
+  }
+}
+
+
+void 
+PlugInManager::initialize( CppUnitTestPlugIn *plugIn )
+{
+  for ( PlugIns::iterator it = m_plugIns.begin(); it != m_plugIns.end(); ++it )
+  {
+    if ( (*it).m_interface != plugIn  ||  (*it).m_initialized )
+      continue;
+
+    // Not initialized if it throws, so that it is not uninitialized either.
+    (*it).m_interface->initialize( &TestFactoryRegistry::getRegistry(), 
+                                   (*it).m_parameters );
+    (*it).m_initialized = true;
+    return;
+  }
+}
+
+
 void 
 PlugInManager::addXmlOutputterHooks( XmlOutputter *outputter )
 {
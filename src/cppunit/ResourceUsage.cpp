@@ -0,0 +1,52 @@
+#include <cppunit/tools/ResourceUsage.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+
+CPPUNIT_NS_BEGIN
+
+
+ResourceUsage ResourceUsage::current()
+{
+	ResourceUsage usage = { 0, 0 };
+#ifdef _WIN32
+	FILETIME creation, exit, kernel, user;
+	if(::GetProcessTimes(::GetCurrentProcess(), &creation, &exit, &kernel, &user))
+	{
+		ULARGE_INTEGER kernelTime, userTime;
+		kernelTime.LowPart = kernel.dwLowDateTime;
+		kernelTime.HighPart = kernel.dwHighDateTime;
+		userTime.LowPart = user.dwLowDateTime;
+		userTime.HighPart = user.dwHighDateTime;
+		usage.cpuTime = (kernelTime.QuadPart + userTime.QuadPart) / 10;
+	}
+
+	PROCESS_MEMORY_COUNTERS counters;
+	if(::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters)))
+		usage.peakMemory = counters.PeakWorkingSetSize / 1024;
+#else
+	struct rusage resources;
+	if(::getrusage(RUSAGE_SELF, &resources) == 0)
+	{
+		usage.cpuTime = (unsigned long long)(resources.ru_utime.tv_sec + resources.ru_stime.tv_sec) * 1000000ULL +
+			resources.ru_utime.tv_usec + resources.ru_stime.tv_usec;
+#ifdef __APPLE__
+		usage.peakMemory = resources.ru_maxrss / 1024;
+#else
+		usage.peakMemory = resources.ru_maxrss;
+#endif
+	}
+#endif
+	return usage;
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,113 @@
+#include <cppunit/ResultComparison.h>
+#include <cppunit/Test.h>
+#include <cppunit/tools/Clock.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+ResultComparison::ResultComparison(const ResultFile::Records& previous, unsigned int threshold, unsigned long long minimumSlowdown)
+	: m_previous()
+	, m_threshold(threshold)
+	, m_minimumSlowdown(minimumSlowdown)
+	, m_newFailures()
+	, m_fixedTests()
+	, m_slowdowns()
+	, m_failed(false)
+	, m_startTime(0)
+{
+	for(ResultFile::Records::const_iterator it = previous.begin(); it != previous.end(); ++it)
+		m_previous[it->name] = *it;
+}
+
+ResultComparison::~ResultComparison()
+{
+}
+
+void ResultComparison::startTest(Test*)
+{
+	m_failed = false;
+	m_startTime = Clock::microseconds();
+}
+
+void ResultComparison::addFailure(const TestFailure&)
+{
+	m_failed = true;
+}
+
+void ResultComparison::endTest(Test* test)
+{
+	unsigned long long duration = Clock::microseconds() - m_startTime;
+	const TestRecord* previous = findPrevious(test);
+
+	if(m_failed)
+	{
+		if(previous == NULL || ! previous->isFailure())
+			m_newFailures.push_back(test->getScopedName());
+	}
+	else if(previous != NULL)
+	{
+		if(previous->isFailure())
+		{
+			m_fixedTests.push_back(test->getScopedName());
+		}
+		else if(previous->duration > 0 && duration >= previous->duration + m_minimumSlowdown &&
+			(duration - previous->duration) * 100 > previous->duration * m_threshold)
+		{
+			Slowdown slowdown;
+			slowdown.name = test->getScopedName();
+			slowdown.previous = previous->duration;
+			slowdown.current = duration;
+			m_slowdowns.push_back(slowdown);
+		}
+	}
+}
+
+const CppUnitVector<std::string>& ResultComparison::newFailures() const
+{
+	return m_newFailures;
+}
+
+const CppUnitVector<std::string>& ResultComparison::fixedTests() const
+{
+	return m_fixedTests;
+}
+
+bool ResultComparison::hasSlowdowns() const
+{
+	return ! m_slowdowns.empty();
+}
+
+void ResultComparison::write(OStream& stream) const
+{
+	stream << "Comparison with previous results:" << "\n";
+	stream << "New failures: " << m_newFailures.size()
+		<< "   Fixed: " << m_fixedTests.size()
+		<< "   Slower: " << m_slowdowns.size() << "\n";
+
+	for(unsigned int index = 0; index < m_newFailures.size(); ++index)
+		stream << "  new failure: " << m_newFailures[index] << "\n";
+
+	for(unsigned int index = 0; index < m_fixedTests.size(); ++index)
+		stream << "  fixed: " << m_fixedTests[index] << "\n";
+
+	for(unsigned int index = 0; index < m_slowdowns.size(); ++index)
+	{
+		const Slowdown& slowdown = m_slowdowns[index];
+		stream << "  slower: " << slowdown.name << " "
+			<< slowdown.previous / 1000 << "ms -> " << slowdown.current / 1000 << "ms (+"
+			<< (slowdown.current - slowdown.previous) * 100 / slowdown.previous << "%)\n";
+	}
+	stream.flush();
+}
+
+const TestRecord* ResultComparison::findPrevious(Test* test) const
+{
+	PreviousRecords::const_iterator it = m_previous.find(test->getScopedName());
+	if(it == m_previous.end())
+		it = m_previous.find(test->getName());
+	return it == m_previous.end() ? NULL : &it->second;
+}
+
+
+CPPUNIT_NS_END
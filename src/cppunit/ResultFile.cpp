@@ -0,0 +1,130 @@
+#include <cppunit/BinaryResultReader.h>
+#include <cppunit/ResultFile.h>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <stdlib.h>
+#include <string.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+namespace
+{
+	std::string unescape(const std::string& value)
+	{
+		static const char* entities[][2] =
+		{
+			{ "&lt;", "<" },
+			{ "&gt;", ">" },
+			{ "&apos;", "'" },
+			{ "&quot;", "\"" },
+			{ "&amp;", "&" }
+		};
+
+		std::string unescaped;
+		for(std::string::size_type index = 0; index < value.length(); ++index)
+		{
+			bool isEntity = false;
+			for(unsigned int entity = 0; entity < sizeof(entities) / sizeof(entities[0]) && value[index] == '&'; ++entity)
+			{
+				std::string::size_type length = ::strlen(entities[entity][0]);
+				if(value.compare(index, length, entities[entity][0]) == 0)
+				{
+					unescaped += entities[entity][1];
+					index += length - 1;
+					isEntity = true;
+					break;
+				}
+			}
+			if(! isEntity)
+				unescaped += value[index];
+		}
+		return unescaped;
+	}
+
+	/// Returns the unescaped content of the first \a name element of \a element.
+	std::string elementContent(const std::string& element, const std::string& name)
+	{
+		std::string::size_type begin = element.find("<" + name + ">");
+		if(begin == std::string::npos)
+			return "";
+		begin += name.length() + 2;
+
+		std::string::size_type end = element.find("</" + name + ">", begin);
+		if(end == std::string::npos)
+			return "";
+		return unescape(element.substr(begin, end - begin));
+	}
+}
+
+
+void ResultFile::load(const std::string& fileName, Records& records)
+{
+	std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+	if(! stream)
+		throw std::runtime_error("ResultFile: failed to open <" + fileName + ">");
+
+	if(BinaryResultReader::isBinaryResult(stream))
+	{
+		BinaryResultReader reader(stream);
+		TestRecord record;
+		while(reader.read(record))
+			records.push_back(record);
+		return;
+	}
+
+	std::ostringstream content;
+	content << stream.rdbuf();
+	if(content.str().find("<TestRun>") == std::string::npos)
+		throw std::runtime_error("ResultFile: <" + fileName + "> is not a test result file");
+
+	loadXml(content.str(), records);
+}
+
+bool ResultFile::hasDurations(const std::string& fileName)
+{
+	std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+	if(! stream)
+		throw std::runtime_error("ResultFile: failed to open <" + fileName + ">");
+	return BinaryResultReader::isBinaryResult(stream);
+}
+
+void ResultFile::loadXml(const std::string& content, Records& records)
+{
+	static const char* elementNames[] = { "FailedTest", "Test" };
+
+	for(unsigned int kind = 0; kind < 2; ++kind)
+	{
+		std::string open = std::string("<") + elementNames[kind] + " ";
+		std::string close = std::string("</") + elementNames[kind] + ">";
+
+		std::string::size_type begin = content.find(open);
+		while(begin != std::string::npos)
+		{
+			std::string::size_type end = content.find(close, begin);
+			if(end == std::string::npos)
+				break;
+
+			std::string element = content.substr(begin, end - begin);
+			TestRecord record;
+			record.name = elementContent(element, "Name");
+			if(kind == 0)
+			{
+				record.status = elementContent(element, "FailureType") == "Error" ? TestRecord::error : TestRecord::failure;
+				record.fileName = elementContent(element, "File");
+				std::string line = elementContent(element, "Line");
+				if(! line.empty())
+					record.lineNumber = ::atoi(line.c_str());
+				record.shortDescription = elementContent(element, "Message");
+			}
+			records.push_back(record);
+
+			begin = content.find(open, end);
+		}
+	}
+}
+
+
+CPPUNIT_NS_END
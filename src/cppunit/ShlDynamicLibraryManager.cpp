@@ -13,7 +13,9 @@ CPPUNIT_NS_BEGIN
 DynamicLibraryManager::LibraryHandle 
 DynamicLibraryManager::doLoadLibrary( const std::string &libraryName )
 {
-   return ::shl_load(libraryName.c_str(), BIND_IMMEDIATE, 0L);
+   return ::shl_load( libraryName.c_str(),
+                     (m_flags & lazyBinding) ? BIND_DEFERRED : BIND_IMMEDIATE,
+                     0L );
 }
 
 
@@ -40,6 +42,13 @@ DynamicLibraryManager::doFindSymbol( const std::string &symbol )
 }
 
 
+const void *
+DynamicLibraryManager::doFindLibraryBase( const void * )
+{
+  return NULL;
+}
+
+
 std::string 
 DynamicLibraryManager::getLastErrorDetail() const
 {
@@ -13,6 +13,26 @@ Test* Test::getChildTestAt(int index) const
 	return doGetChildTestAt(index);
 }
 
+std::string Test::getTestNamePrefix() const
+{
+	return std::string();
+}
+
+bool Test::keepsChildTestsGrouped() const
+{
+	return false;
+}
+
+std::string Test::getProperty(const std::string&) const
+{
+	return std::string();
+}
+
+Test* Test::getDescription() const
+{
+	return CPPUNIT_CONST_CAST(Test*, this);
+}
+
 Test* Test::findTest(const std::string& testName) const
 {
 	TestPath path;
@@ -32,6 +52,10 @@ bool Test::findTestPath(const std::string& testName, TestPath& testPath) const
 		return true;
 	}
 
+	std::string prefix = getTestNamePrefix();
+	if(testName.compare(0, prefix.length(), prefix) != 0)
+		return false;
+
 	int childCount = getChildTestCount();
 	for(int childIndex = 0; childIndex < childCount; ++childIndex)
 	{
@@ -49,6 +49,9 @@ TestCase::TestCase(const std::string& name)
 /// Run the test and catch any exceptions that are triggered by it 
 void TestCase::run(TestResult* result)
 {
+	if(! result->shouldRun(this))
+		return;
+
 	result->startTest(this);
 	if(result->protect(TestCaseMethodFunctor(this, &TestCase::setUp), this, "setUp() failed"))
 		result->protect(TestCaseMethodFunctor(this, &TestCase::runTest), this);
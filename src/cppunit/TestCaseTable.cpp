@@ -0,0 +1,174 @@
+#include <cppunit/TestCaseTable.h>
+#include <cppunit/Protector.h>
+#include <cppunit/TestLeaf.h>
+#include <cppunit/TestResult.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+namespace
+{
+	const int proxiesPerBlock = 256;
+}
+
+
+/*! \brief Proxy of a test case of a TestCaseTable (Implementation).
+ *
+ * Implementation detail.
+ */
+class TestCaseTable::Case : public TestLeaf
+{
+public:
+	typedef void (Case::*Method)();
+
+	/// Calls a method of the proxy in TestResult::protect().
+	class MethodFunctor : public Functor
+	{
+	public:
+		MethodFunctor(Case* target, Method method)
+			: m_target(target)
+			, m_method(method)
+		{
+		}
+
+		bool operator()() const
+		{
+			(m_target->*m_method)();
+			return true;
+		}
+
+	private:
+		Case* m_target;
+		Method m_method;
+	};
+
+	Case()
+		: m_table(NULL)
+		, m_index(0)
+	{
+	}
+
+	void run(TestResult* result)
+	{
+		if(! result->shouldRun(this))
+			return;
+
+		result->startTest(this);
+		if(result->protect(MethodFunctor(this, &Case::setUp), this, "setUp() failed"))
+			result->protect(MethodFunctor(this, &Case::runTest), this);
+
+		result->protect(MethodFunctor(this, &Case::tearDown), this, "tearDown() failed");
+
+		result->endTest(this);
+	}
+
+	std::string getName() const
+	{
+		return m_table->getCaseName(m_index);
+	}
+
+	std::string getScopedName() const
+	{
+		return m_table->getName() + "::" + m_table->getCaseName(m_index);
+	}
+
+	void setUp()
+	{
+		m_table->setUpCase(m_index);
+	}
+
+	void runTest()
+	{
+		m_table->runCase(m_index);
+	}
+
+	void tearDown()
+	{
+		m_table->tearDownCase(m_index);
+	}
+
+	TestCaseTable* m_table;
+	int            m_index;
+};
+
+
+TestCaseTable::TestCaseTable(const std::string& name)
+	: TestComposite(name)
+	, m_cases()
+	, m_names()
+	, m_proxies()
+{
+}
+
+TestCaseTable::~TestCaseTable()
+{
+	for(Proxies::iterator it = m_proxies.begin(); it != m_proxies.end(); ++it)
+		delete [] *it;
+}
+
+void TestCaseTable::reserve(int caseCount, size_t nameSize)
+{
+	m_cases.reserve(caseCount);
+	m_names.reserve(nameSize);
+}
+
+int TestCaseTable::countTestCases() const
+{
+	return m_cases.size();
+}
+
+int TestCaseTable::getChildTestCount() const
+{
+	return m_cases.size();
+}
+
+std::string TestCaseTable::getCaseName(int index) const
+{
+	return std::string(m_names.c_str() + m_cases[index].nameOffset);
+}
+
+unsigned int TestCaseTable::getCaseParameter(int index) const
+{
+	return m_cases[index].parameter;
+}
+
+unsigned int TestCaseTable::getCaseMethod(int index) const
+{
+	return m_cases[index].method;
+}
+
+void TestCaseTable::addCase(const std::string& name, unsigned int method, unsigned int parameter)
+{
+	Descriptor descriptor;
+	descriptor.nameOffset = m_names.size();
+	descriptor.method = method;
+	descriptor.parameter = parameter;
+	m_cases.push_back(descriptor);
+
+	m_names += name;
+	m_names += '\0';
+}
+
+Test* TestCaseTable::doGetChildTestAt(int index) const
+{
+	unsigned int block = index / proxiesPerBlock;
+	if(block >= m_proxies.size())
+		m_proxies.resize(block + 1, NULL);
+
+	Case* proxies = m_proxies[block];
+	if(proxies == NULL)
+	{
+		proxies = new Case[proxiesPerBlock];
+		for(int offset = 0; offset < proxiesPerBlock; ++offset)
+		{
+			proxies[offset].m_table = const_cast<TestCaseTable*>(this);
+			proxies[offset].m_index = block * proxiesPerBlock + offset;
+		}
+		m_proxies[block] = proxies;
+	}
+	return &proxies[index % proxiesPerBlock];
+}
+
+
+CPPUNIT_NS_END
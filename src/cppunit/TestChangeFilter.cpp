@@ -0,0 +1,130 @@
+#include <cppunit/TestChangeFilter.h>
+#include <cppunit/Test.h>
+#include <stdlib.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+TestChangeFilter::TestChangeFilter(const CoverageIndex& index)
+	: m_index(index)
+	, m_selected(index.testCount(), false)
+	, m_changedFile(index.testCount(), false)
+{
+}
+
+TestChangeFilter::~TestChangeFilter()
+{
+}
+
+void TestChangeFilter::addChange(const std::string& fileName, unsigned int first, unsigned int last)
+{
+	for(unsigned int file = 0; file < m_index.fileCount(); ++file)
+	{
+		if(! matchesFile(m_index.fileName(file), fileName))
+			continue;
+
+		for(unsigned int test = 0; test < m_index.testCount(); ++test)
+		{
+			if(m_index.lines(test, file).empty())
+				continue;
+			m_changedFile[test] = true;
+			if(m_index.covers(test, file, first, last))
+				m_selected[test] = true;
+		}
+	}
+}
+
+void TestChangeFilter::addDiff(std::istream& diff)
+{
+	std::string fileName;
+	unsigned long oldLines = 0;
+	unsigned long newLines = 0;
+
+	std::string line;
+	while(std::getline(diff, line))
+	{
+		// Lines of a hunk are only told from the headers by counting them.
+		if(oldLines > 0 || newLines > 0)
+		{
+			char kind = line.empty() ? ' ' : line[0];
+			if(kind != '+' && kind != '\\' && oldLines > 0)
+				--oldLines;
+			if(kind != '-' && kind != '\\' && newLines > 0)
+				--newLines;
+			continue;
+		}
+
+		if(line.compare(0, 4, "--- ") == 0 || line.compare(0, 4, "+++ ") == 0)
+		{
+			std::string name = line.substr(4);
+			name = name.substr(0, name.find('\t'));
+			if(name == "/dev/null")
+				name.clear();
+			else if(name.compare(0, 2, "a/") == 0 || name.compare(0, 2, "b/") == 0)
+				name = name.substr(2);
+
+			// The old name is the name of the indexed file.
+			if(line[0] == '-' || fileName.empty())
+				fileName = name;
+		}
+		else if(line.compare(0, 4, "@@ -") == 0 && ! fileName.empty())
+		{
+			char* end = NULL;
+			unsigned long first = ::strtoul(line.c_str() + 4, &end, 10);
+			oldLines = 1;
+			if(*end == ',')
+				oldLines = ::strtoul(end + 1, &end, 10);
+			newLines = 1;
+			std::string::size_type added = line.find(" +", end - line.c_str());
+			if(added != std::string::npos)
+			{
+				::strtoul(line.c_str() + added + 2, &end, 10);
+				if(*end == ',')
+					newLines = ::strtoul(end + 1, &end, 10);
+			}
+
+			if(oldLines > 0)
+				addChange(fileName, first, first + oldLines - 1);
+			else
+				addChange(fileName, first, first + 1);
+		}
+		else if(line.compare(0, 5, "diff ") == 0)
+		{
+			fileName.clear();
+		}
+	}
+}
+
+bool TestChangeFilter::accept(Test* test) const
+{
+	int index = m_index.findTest(test->getScopedName());
+	return index < 0 || m_selected[index];
+}
+
+bool TestChangeFilter::acceptPrefix(const std::string& prefix) const
+{
+	bool isIndexed = false;
+	for(unsigned int test = 0; test < m_index.testCount(); ++test)
+	{
+		if(m_index.testName(test).compare(0, prefix.length(), prefix) != 0)
+			continue;
+		if(m_selected[test] || m_changedFile[test])
+			return true;
+		isIndexed = true;
+	}
+	return ! isIndexed;
+}
+
+bool TestChangeFilter::matchesFile(const std::string& indexedName, const std::string& fileName)
+{
+	if(indexedName.length() < fileName.length())
+		return false;
+	if(indexedName.length() == fileName.length())
+		return indexedName == fileName;
+	return indexedName[indexedName.length() - fileName.length() - 1] == '/'
+		&& indexedName.compare(indexedName.length() - fileName.length(), fileName.length(), fileName) == 0;
+}
+
+
+CPPUNIT_NS_END
@@ -15,6 +15,9 @@ TestComposite::~TestComposite()
 
 void TestComposite::run(TestResult* result)
 {
+	if(! result->shouldRun(this))
+		return;
+
 	doStartSuite(result);
 	doRunChildTests(result);
 	doEndSuite(result);
@@ -43,6 +43,13 @@ TestDecorator::getChildTestCount() const
 }
 
 
+bool 
+TestDecorator::keepsChildTestsGrouped() const
+{
+  return true;
+}
+
+
 Test *
 TestDecorator::doGetChildTestAt( int index ) const
 {
@@ -1,7 +1,10 @@
 #include <cppunit/config/SourcePrefix.h>
+#include <cppunit/extensions/LazyTestSuite.h>
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/portability/CppUnitMap.h>
+#include <cppunit/portability/CppUnitVector.h>
 #include <cppunit/TestSuite.h>
+#include <algorithm>
 #include <assert.h>
 
 
@@ -103,17 +106,17 @@ TestFactoryRegistry::getRegistry( const std::string &name )
 
 
 void 
-TestFactoryRegistry::registerFactory( const std::string &,
+TestFactoryRegistry::registerFactory( const std::string &name,
                                       TestFactory *factory )
 {
-  registerFactory( factory );
+  m_factories[ factory ] = name;
 }
 
 
 void 
 TestFactoryRegistry::registerFactory( TestFactory *factory )
 {
-  m_factories.insert( factory );
+  m_factories[ factory ] = std::string();
 }
 
 
@@ -124,6 +127,22 @@ TestFactoryRegistry::unregisterFactory( TestFactory *factory )
 }
 
 
+void 
+TestFactoryRegistry::getFactories( CppUnitVector<TestFactory *> &factories ) const
+{
+  for ( Factories::const_iterator it = m_factories.begin(); it != m_factories.end(); ++it )
+    factories.push_back( it->first );
+}
+
+
+std::string 
+TestFactoryRegistry::getFactoryName( TestFactory *factory ) const
+{
+  Factories::const_iterator it = m_factories.find( factory );
+  return it == m_factories.end() ? std::string() : it->second;
+}
+
+
 void 
 TestFactoryRegistry::addRegistry( const std::string &name )
 {
@@ -140,16 +159,40 @@ TestFactoryRegistry::makeTest()
 }
 
 
+namespace
+{
+  typedef std::pair<std::string, Test *> NamedTest;
+
+  bool lessName( const NamedTest &left, const NamedTest &right )
+  {
+    return left.first < right.first;
+  }
+}
+
+
 void 
 TestFactoryRegistry::addTestToSuite( TestSuite *suite )
 {
+  // The factories without a name are made now to find out the name of their test.
+  CppUnitVector<NamedTest> tests;
   for ( Factories::iterator it = m_factories.begin(); 
         it != m_factories.end(); 
         ++it )
   {
-    TestFactory *factory = *it;
-    suite->addTest( factory->makeTest() );
+    TestFactory *factory = it->first;
+    const std::string &name = it->second;
+    if ( name.empty() )
+    {
+      Test *test = factory->makeTest();
+      tests.push_back( NamedTest( test->getName(), test ) );
+    }
+    else
+      tests.push_back( NamedTest( name, new LazyTestSuite( name, factory ) ) );
   }
+
+  std::stable_sort( tests.begin(), tests.end(), lessName );
+  for ( unsigned int index = 0; index < tests.size(); ++index )
+    suite->addTest( tests[index].second );
 }
 
 
@@ -2,6 +2,10 @@
 #include <cppunit/Test.h>
 #include <cppunit/TestFailure.h>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 CPPUNIT_NS_BEGIN
 
 
@@ -11,7 +15,9 @@ TestFailure::TestFailure( Test *failedTest,
                           bool isError ) :
     m_failedTest( failedTest ), 
     m_thrownException( thrownException ),
-    m_isError( isError )
+    m_isError( isError ),
+    m_capturedOutput(),
+    m_referenceCount( 0 )
 {
 }
 
@@ -61,10 +67,90 @@ TestFailure::failedTestName() const
 }
 
 
+/// Gets the output captured while the test was run.
+std::string 
+TestFailure::capturedOutput() const
+{
+  return m_capturedOutput;
+}
+
+
+/// Sets the output captured while the test was run.
+void 
+TestFailure::setCapturedOutput( const std::string &output )
+{
+  m_capturedOutput = output;
+}
+
+
 TestFailure *
 TestFailure::clone() const
 {
-  return new TestFailure( m_failedTest, m_thrownException->clone(), m_isError );
+  TestFailure *failure = new TestFailure( m_failedTest, 
+                                          m_thrownException->clone(), 
+                                          m_isError );
+  failure->setCapturedOutput( m_capturedOutput );
+  return failure;
+}
+
+
+TestFailure *
+TestFailure::create( Test *failedTest, 
+                     Exception *thrownException,
+                     bool isError )
+{
+  TestFailure *failure = new TestFailure( failedTest, thrownException, isError );
+  failure->m_referenceCount = 1;
+  return failure;
+}
+
+
+TestFailure *
+TestFailure::share() const
+{
+  if ( m_referenceCount == 0 )
+  {
+    TestFailure *failure = clone();
+    failure->m_referenceCount = 1;
+    return failure;
+  }
+
+#if defined(_MSC_VER)
+  _InterlockedIncrement( &m_referenceCount );
+#else
+  __sync_add_and_fetch( &m_referenceCount, 1 );
+#endif
+  return const_cast<TestFailure *>( this );
+}
+
+
+void 
+TestFailure::release() const
+{
+  if ( m_referenceCount != 0 )
+  {
+#if defined(_MSC_VER)
+    if ( _InterlockedDecrement( &m_referenceCount ) != 0 )
+      return;
+#else
+    if ( __sync_sub_and_fetch( &m_referenceCount, 1 ) != 0 )
+      return;
+#endif
+  }
+  delete this;
+}
+
+
+TestFailure *
+TestFailure::unshare() const
+{
+  if ( m_referenceCount <= 1 )
+    return const_cast<TestFailure *>( this );
+
+  TestFailure *failure = clone();
+  failure->m_referenceCount = 1;
+  release();
+  return failure;
 }
 
 
@@ -0,0 +1,312 @@
+#include <cppunit/TestHistory.h>
+#include <cppunit/TestJournal.h>
+#include <cppunit/tools/MappedFile.h>
+#include <errno.h>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+
+CPPUNIT_NS_BEGIN
+
+
+const char* TestHistory::columnFileNames[columnCount] =
+{
+	"run.col",
+	"test.col",
+	"status.col",
+	"duration.col",
+	"cputime.col",
+	"memory.col"
+};
+
+const size_t TestHistory::columnWidths[columnCount] =
+{
+	sizeof(uint32_t),
+	sizeof(uint64_t),
+	sizeof(uint8_t),
+	sizeof(uint64_t),
+	sizeof(uint64_t),
+	sizeof(uint64_t)
+};
+
+
+TestHistory::TestHistory(const std::string& directory, bool writable)
+	: m_directory(directory)
+	, m_writable(writable)
+	, m_names()
+	, m_newNames()
+	, m_runCount(0)
+	, m_rowCount(0)
+{
+	for(int column = 0; column < columnCount; ++column)
+		m_columns[column] = NULL;
+
+	if(writable)
+	{
+#ifdef _WIN32
+		int result = ::_mkdir(directory.c_str());
+#else
+		int result = ::mkdir(directory.c_str(), 0755);
+#endif
+		if(result != 0 && errno != EEXIST)
+			throw std::runtime_error("TestHistory: failed to create <" + directory + ">");
+	}
+	else if(! std::ifstream(path("runs.txt").c_str(), std::ios::in | std::ios::binary))
+		throw std::runtime_error("TestHistory: failed to open <" + directory + ">");
+
+	readNames();
+	readRuns();
+}
+
+TestHistory::~TestHistory()
+{
+	unload();
+}
+
+unsigned long long TestHistory::addTest(const std::string& name)
+{
+	unsigned long long testId = TestJournal::testId(name);
+	if(m_names.find(testId) != m_names.end())
+		return testId;
+
+	m_names.insert(std::pair<const unsigned long long, std::string>(testId, name));
+
+	std::ostringstream line;
+	line << std::hex << testId << ' ' << name << '\n';
+	m_newNames += line.str();
+	return testId;
+}
+
+unsigned int TestHistory::addRun()
+{
+	if(! m_writable)
+		throw std::runtime_error("TestHistory: failed to write <" + m_directory + ">, opened for reading");
+
+	// Creates the columns with the first run, even if it adds no row.
+	for(int column = 0; column < columnCount; ++column)
+		std::ofstream(path(columnFileNames[column]).c_str(), std::ios::out | std::ios::app | std::ios::binary);
+
+	std::ofstream stream(path("runs.txt").c_str(), std::ios::out | std::ios::app | std::ios::binary);
+	stream << m_runCount << ' ' << (unsigned long long)::time(NULL) << '\n';
+	if(! stream)
+		throw std::runtime_error("TestHistory: failed to write <" + path("runs.txt") + ">");
+	return m_runCount++;
+}
+
+void TestHistory::addRows(unsigned int runId, const Rows& rows)
+{
+	if(! m_writable)
+		throw std::runtime_error("TestHistory: failed to write <" + m_directory + ">, opened for reading");
+
+	if(! m_newNames.empty())
+	{
+		std::ofstream stream(path("names.txt").c_str(), std::ios::out | std::ios::app | std::ios::binary);
+		stream << m_newNames;
+		if(! stream)
+			throw std::runtime_error("TestHistory: failed to write <" + path("names.txt") + ">");
+		m_newNames.clear();
+	}
+
+	if(rows.empty())
+		return;
+
+	truncateColumns();
+
+	CppUnitVector<uint32_t> runIds(rows.size(), runId);
+	CppUnitVector<uint64_t> testIds;
+	CppUnitVector<uint8_t> statuses;
+	CppUnitVector<uint64_t> durations;
+	CppUnitVector<uint64_t> cpuTimes;
+	CppUnitVector<uint64_t> peakMemories;
+	for(Rows::const_iterator it = rows.begin(); it != rows.end(); ++it)
+	{
+		testIds.push_back(it->testId);
+		statuses.push_back(it->status);
+		durations.push_back(it->duration);
+		cpuTimes.push_back(it->cpuTime);
+		peakMemories.push_back(it->peakMemory);
+	}
+
+	appendColumn(runColumn, &runIds[0], runIds.size() * sizeof(uint32_t));
+	appendColumn(testColumn, &testIds[0], testIds.size() * sizeof(uint64_t));
+	appendColumn(statusColumn, &statuses[0], statuses.size() * sizeof(uint8_t));
+	appendColumn(durationColumn, &durations[0], durations.size() * sizeof(uint64_t));
+	appendColumn(cpuTimeColumn, &cpuTimes[0], cpuTimes.size() * sizeof(uint64_t));
+	appendColumn(memoryColumn, &peakMemories[0], peakMemories.size() * sizeof(uint64_t));
+}
+
+void TestHistory::load()
+{
+	unload();
+	if(m_runCount == 0)
+		return;
+
+	try
+	{
+		m_rowCount = (size_t)-1;
+		for(int column = 0; column < columnCount; ++column)
+		{
+			m_columns[column] = new MappedFile(path(columnFileNames[column]));
+			size_t rowCount = m_columns[column]->size() / columnWidths[column];
+			if(rowCount < m_rowCount)
+				m_rowCount = rowCount;
+		}
+	}
+	catch(...)
+	{
+		unload();
+		throw;
+	}
+}
+
+unsigned int TestHistory::runCount() const
+{
+	return m_runCount;
+}
+
+size_t TestHistory::rowCount() const
+{
+	return m_rowCount;
+}
+
+const unsigned int* TestHistory::runIds() const
+{
+	return (const unsigned int*)columnData(runColumn);
+}
+
+const unsigned long long* TestHistory::testIds() const
+{
+	return (const unsigned long long*)columnData(testColumn);
+}
+
+const unsigned char* TestHistory::statuses() const
+{
+	return (const unsigned char*)columnData(statusColumn);
+}
+
+const unsigned long long* TestHistory::durations() const
+{
+	return (const unsigned long long*)columnData(durationColumn);
+}
+
+const unsigned long long* TestHistory::cpuTimes() const
+{
+	return (const unsigned long long*)columnData(cpuTimeColumn);
+}
+
+const unsigned long long* TestHistory::peakMemories() const
+{
+	return (const unsigned long long*)columnData(memoryColumn);
+}
+
+std::string TestHistory::testName(unsigned long long testId) const
+{
+	TestNames::const_iterator it = m_names.find(testId);
+	if(it != m_names.end())
+		return it->second;
+
+	std::ostringstream stream;
+	stream << std::hex << testId;
+	return stream.str();
+}
+
+void TestHistory::readNames()
+{
+	std::ifstream stream(path("names.txt").c_str(), std::ios::in | std::ios::binary);
+	std::string line;
+	while(std::getline(stream, line))
+	{
+		std::string::size_type separator = line.find(' ');
+		if(separator == std::string::npos)
+			continue;
+
+		unsigned long long testId = 0;
+		std::istringstream(line.substr(0, separator)) >> std::hex >> testId;
+		m_names[testId] = line.substr(separator + 1);
+	}
+}
+
+void TestHistory::readRuns()
+{
+	std::ifstream stream(path("runs.txt").c_str(), std::ios::in | std::ios::binary);
+	std::string line;
+	while(std::getline(stream, line))
+		++m_runCount;
+}
+
+void TestHistory::appendColumn(Column column, const void* data, size_t size)
+{
+	std::ofstream stream(path(columnFileNames[column]).c_str(), std::ios::out | std::ios::app | std::ios::binary);
+	stream.write((const char*)data, size);
+	if(! stream)
+		throw std::runtime_error("TestHistory: failed to write <" + path(columnFileNames[column]) + ">");
+}
+
+void TestHistory::truncateColumns()
+{
+	size_t sizes[columnCount];
+	size_t rowCount = (size_t)-1;
+	for(int column = 0; column < columnCount; ++column)
+	{
+		std::ifstream stream(path(columnFileNames[column]).c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+		sizes[column] = stream ? (size_t)stream.tellg() : 0;
+		if(sizes[column] / columnWidths[column] < rowCount)
+			rowCount = sizes[column] / columnWidths[column];
+	}
+
+	// Drops the rows of an interrupted run, so that the new rows stay aligned.
+	for(int column = 0; column < columnCount; ++column)
+	{
+		size_t size = rowCount * columnWidths[column];
+		if(sizes[column] == size)
+			continue;
+
+		std::string fileName = path(columnFileNames[column]);
+#ifdef _WIN32
+		int file = ::_open(fileName.c_str(), _O_RDWR | _O_BINARY);
+		int result = file < 0 ? -1 : ::_chsize_s(file, size);
+		if(file >= 0)
+			::_close(file);
+#else
+		int result = ::truncate(fileName.c_str(), size);
+#endif
+		if(result != 0)
+			throw std::runtime_error("TestHistory: failed to truncate <" + fileName + ">");
+	}
+}
+
+void TestHistory::unload()
+{
+	for(int column = 0; column < columnCount; ++column)
+	{
+		delete m_columns[column];
+		m_columns[column] = NULL;
+	}
+	m_rowCount = 0;
+}
+
+std::string TestHistory::path(const std::string& fileName) const
+{
+	return m_directory + "/" + fileName;
+}
+
+const char* TestHistory::columnData(Column column) const
+{
+	return m_columns[column] ? m_columns[column]->data() : NULL;
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,319 @@
+#include <cppunit/TestJournal.h>
+#include <cppunit/tools/MappedFile.h>
+#include <stdexcept>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+CPPUNIT_NS_BEGIN
+
+
+namespace
+{
+	const char journalMagic[8] = { 'C', 'P', 'P', 'U', 'J', 'R', 'N', 'L' };
+	const uint32_t journalVersion = 1;
+	const size_t journalInitialSize = 64 * 1024;
+
+	enum EntryKind
+	{
+		endOfJournal = 0,
+		testEntry,
+		failureEntry
+	};
+
+	struct JournalHeader
+	{
+		char     magic[8];
+		uint32_t version;
+		uint32_t reserved;
+	};
+
+	/// Common header of all the entries. The kind is written last.
+	struct JournalEntry
+	{
+		uint32_t kind;
+		uint32_t size;
+	};
+
+	/// Fixed-size test record, followed by the test name.
+	struct JournalTestEntry
+	{
+		JournalEntry entry;
+		uint64_t     testId;
+		uint64_t     duration;
+		uint64_t     failureOffset;
+		uint32_t     status;
+		uint32_t     nameLength;
+	};
+
+	/// Failure, followed by the file name, short description and details, each '\0' terminated.
+	struct JournalFailureEntry
+	{
+		JournalEntry entry;
+		int32_t      lineNumber;
+		uint32_t     detailCount;
+		uint32_t     textLength;
+		uint32_t     reserved;
+	};
+
+	size_t aligned(size_t size)
+	{
+		return (size + 7) & ~(size_t)7;
+	}
+}
+
+
+TestJournal::TestJournal(const std::string& fileName, bool append)
+	: m_file(new MappedFile(fileName, true))
+	, m_records()
+	, m_indexes()
+	, m_end(sizeof(JournalHeader))
+	, m_current(0)
+{
+	try
+	{
+		if(! append || m_file->size() == 0)
+			initialize();
+		else if(! read())
+			throw std::runtime_error("TestJournal: <" + fileName + "> is not a test journal");
+	}
+	catch(...)
+	{
+		delete m_file;
+		throw;
+	}
+}
+
+TestJournal::~TestJournal()
+{
+	try
+	{
+		m_file->resize(m_end + sizeof(JournalEntry));
+		m_file->flush();
+	}
+	catch(...)
+	{
+	}
+	delete m_file;
+}
+
+const TestJournal::Records& TestJournal::records() const
+{
+	return m_records;
+}
+
+const TestJournal::Record* TestJournal::find(const std::string& name) const
+{
+	RecordIndexes::const_iterator it = m_indexes.find(name);
+	if(it == m_indexes.end())
+		return NULL;
+	return &m_records[it->second];
+}
+
+void TestJournal::startTest(const std::string& name)
+{
+	size_t offset = m_end;
+	char* data = allocate(sizeof(JournalTestEntry) + name.length());
+
+	JournalTestEntry* entry = (JournalTestEntry*)data;
+	entry->testId = testId(name);
+	entry->duration = 0;
+	entry->failureOffset = 0;
+	entry->status = TestRecord::running;
+	entry->nameLength = name.length();
+	::memcpy(data + sizeof(JournalTestEntry), name.data(), name.length());
+	commit(data, testEntry);
+
+	m_current = offset;
+}
+
+void TestJournal::addFailure(const TestFailure& failure)
+{
+	if(m_current == 0)
+		return;
+	if(((JournalTestEntry*)(m_file->data() + m_current))->failureOffset != 0)
+		return;
+
+	TestRecord record;
+	record.setFailure(failure);
+
+	std::string text = record.fileName;
+	text += '\0';
+	text += record.shortDescription;
+	text += '\0';
+	for(unsigned int index = 0; index < record.details.size(); ++index)
+	{
+		text += record.details[index];
+		text += '\0';
+	}
+
+	size_t offset = m_end;
+	char* data = allocate(sizeof(JournalFailureEntry) + text.length());
+
+	JournalFailureEntry* entry = (JournalFailureEntry*)data;
+	entry->lineNumber = record.lineNumber;
+	entry->detailCount = record.details.size();
+	entry->textLength = text.length();
+	::memcpy(data + sizeof(JournalFailureEntry), text.data(), text.length());
+	commit(data, failureEntry);
+
+	((JournalTestEntry*)(m_file->data() + m_current))->failureOffset = offset;
+}
+
+void TestJournal::endTest(Status status, unsigned long long duration)
+{
+	if(m_current == 0)
+		return;
+
+	char* data = m_file->data() + m_current;
+	((JournalTestEntry*)data)->duration = duration;
+	commit(data + offsetof(JournalTestEntry, status), status);
+	m_current = 0;
+}
+
+void TestJournal::flush()
+{
+	m_file->flush();
+}
+
+unsigned long long TestJournal::testId(const std::string& name)
+{
+	unsigned long long hash = 14695981039346656037ULL;
+	for(std::string::const_iterator it = name.begin(); it != name.end(); ++it)
+	{
+		hash ^= (unsigned char)*it;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+void TestJournal::initialize()
+{
+	m_file->resize(0);
+	m_file->resize(journalInitialSize);
+
+	JournalHeader* header = (JournalHeader*)m_file->data();
+	::memcpy(header->magic, journalMagic, sizeof(journalMagic));
+	header->version = journalVersion;
+	header->reserved = 0;
+	m_end = sizeof(JournalHeader);
+}
+
+bool TestJournal::read()
+{
+	const char* data = m_file->data();
+	size_t size = m_file->size();
+
+	const JournalHeader* header = (const JournalHeader*)data;
+	if(size < sizeof(JournalHeader) || ::memcmp(header->magic, journalMagic, sizeof(journalMagic)) != 0 || header->version != journalVersion)
+		return false;
+
+	size_t offset = sizeof(JournalHeader);
+	while(offset + sizeof(JournalEntry) <= size)
+	{
+		const JournalEntry* entry = (const JournalEntry*)(data + offset);
+		if(entry->kind == endOfJournal || entry->size < sizeof(JournalEntry) || offset + entry->size > size)
+			break;
+
+		if(entry->kind == testEntry && entry->size >= sizeof(JournalTestEntry))
+		{
+			const JournalTestEntry* test = (const JournalTestEntry*)entry;
+			if(sizeof(JournalTestEntry) + test->nameLength <= entry->size)
+			{
+				Record record;
+				record.name.assign(data + offset + sizeof(JournalTestEntry), test->nameLength);
+				record.status = (Status)test->status;
+				record.duration = test->duration;
+				readFailure(test->failureOffset, record);
+
+				RecordIndexes::iterator it = m_indexes.find(record.name);
+				if(it == m_indexes.end())
+				{
+					m_indexes.insert(std::pair<const std::string, unsigned int>(record.name, m_records.size()));
+					m_records.push_back(record);
+				}
+				else
+				{
+					m_records[it->second] = record;
+				}
+			}
+		}
+
+		offset += entry->size;
+	}
+
+	// Anything after the last committed entry was left by an interrupted write.
+	m_end = offset;
+	if(m_end + sizeof(JournalEntry) > size)
+		m_file->resize(aligned(m_end + sizeof(JournalEntry)));
+	::memset(m_file->data() + m_end, 0, m_file->size() - m_end);
+	return true;
+}
+
+void TestJournal::readFailure(unsigned long long offset, Record& record) const
+{
+	const char* data = m_file->data();
+	if(offset == 0 || offset + sizeof(JournalFailureEntry) > m_file->size())
+		return;
+
+	const JournalFailureEntry* failure = (const JournalFailureEntry*)(data + offset);
+	if(failure->entry.kind != failureEntry || offset + sizeof(JournalFailureEntry) + failure->textLength > m_file->size())
+		return;
+
+	const char* text = data + offset + sizeof(JournalFailureEntry);
+	const char* end = text + failure->textLength;
+
+	std::string strings[2];
+	for(int index = 0; index < 2 && text < end; ++index)
+	{
+		strings[index] = std::string(text, ::strnlen(text, end - text));
+		text += strings[index].length() + 1;
+	}
+	record.fileName = strings[0];
+	record.shortDescription = strings[1];
+	record.lineNumber = failure->lineNumber;
+
+	for(uint32_t index = 0; index < failure->detailCount && text < end; ++index)
+	{
+		std::string detail(text, ::strnlen(text, end - text));
+		record.details.push_back(detail);
+		text += detail.length() + 1;
+	}
+}
+
+char* TestJournal::allocate(unsigned int size)
+{
+	size_t entrySize = aligned(size);
+	size_t required = m_end + entrySize + sizeof(JournalEntry);
+	if(required > m_file->size())
+	{
+		size_t newSize = m_file->size() * 2;
+		if(newSize < required)
+			newSize = aligned(required);
+		m_file->resize(newSize);
+	}
+
+	char* data = m_file->data() + m_end;
+	((JournalEntry*)data)->size = entrySize;
+	m_end += entrySize;
+	return data;
+}
+
+void TestJournal::commit(char* field, unsigned int value)
+{
+	// The whole entry must be visible before the field that publishes it.
+#if defined(__GNUC__)
+	__sync_synchronize();
+#elif defined(_MSC_VER)
+	_ReadWriteBarrier();
+#endif
+	*(volatile uint32_t*)field = value;
+}
+
+
+CPPUNIT_NS_END
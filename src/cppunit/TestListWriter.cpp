@@ -0,0 +1,189 @@
+#include <cppunit/TestListWriter.h>
+#include <cppunit/Test.h>
+#include <cppunit/TestResult.h>
+#include <stdio.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+TestListWriter::TestListWriter(Test* root, TestResult* controller)
+	: m_entries()
+{
+	add(root, 0, controller);
+}
+
+TestListWriter::~TestListWriter()
+{
+}
+
+int TestListWriter::testCount() const
+{
+	return m_entries.empty() ? 0 : m_entries.front().testCount;
+}
+
+bool TestListWriter::isComplete() const
+{
+	return m_entries.empty() || m_entries.front().isComplete;
+}
+
+int TestListWriter::add(Test* test, int depth, TestResult* controller)
+{
+	// Skips the suites that can be rejected by name without being made.
+	if(controller != NULL && ! test->getTestNamePrefix().empty() && ! controller->shouldRun(test))
+		return 0;
+
+	unsigned int index = m_entries.size();
+	Entry entry;
+	entry.test = test;
+	entry.depth = depth;
+	entry.testCount = 0;
+	entry.isComplete = true;
+
+	// A suite that is made when needed is listed from its description, which
+	// creates no fixture. Without a description, it is listed by its name
+	// only, unless the filters need its test cases.
+	Test* described = test->getDescription();
+	entry.isLazy = described == NULL && (controller == NULL || ! controller->hasFilters());
+	if(entry.isLazy)
+	{
+		entry.isSuite = true;
+		entry.isComplete = false;
+		m_entries.push_back(entry);
+		return 0;
+	}
+	if(described == NULL)
+		described = test;
+
+	entry.isSuite = described->getChildTestCount() > 0;
+	m_entries.push_back(entry);
+
+	int count = 0;
+	if(entry.isSuite)
+	{
+		int childCount = described->getChildTestCount();
+		for(int child = 0; child < childCount; ++child)
+		{
+			unsigned int childIndex = m_entries.size();
+			count += add(described->getChildTestAt(child), depth + 1, controller);
+			if(childIndex < m_entries.size() && ! m_entries[childIndex].isComplete)
+				m_entries[index].isComplete = false;
+		}
+	}
+	else if(controller == NULL || controller->shouldRun(test))
+	{
+		count = 1;
+	}
+
+	// Drops the suites and test cases without any selected test case or lazy suite.
+	if(count == 0 && m_entries.size() == index + 1)
+		m_entries.erase(m_entries.begin() + index, m_entries.end());
+	else
+		m_entries[index].testCount = count;
+	return count;
+}
+
+void TestListWriter::write(OStream& stream) const
+{
+	std::string text;
+	char count[32];
+	for(Entries::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		text.append(2 * it->depth, ' ');
+		if(it->isLazy)
+		{
+			text += it->test->getName();
+			text += ": lazy suite\n";
+		}
+		else if(it->isSuite)
+		{
+			// The count of a suite holding lazy suites is only a lower bound.
+			::sprintf(count, it->isComplete ? ": %d tests\n" : ": %d+ tests\n", it->testCount);
+			text += it->test->getName();
+			text += count;
+		}
+		else
+		{
+			text += it->test->getScopedName();
+			text += '\n';
+		}
+	}
+	stream.write(text.data(), text.length());
+	stream.flush();
+}
+
+void TestListWriter::writeJson(OStream& stream) const
+{
+	std::string text;
+	if(m_entries.empty())
+		text = "{}";
+	else
+		writeJson(0, text);
+	text += '\n';
+	stream.write(text.data(), text.length());
+	stream.flush();
+}
+
+unsigned int TestListWriter::writeJson(unsigned int index, std::string& text) const
+{
+	const Entry& entry = m_entries[index];
+	text += "{\"name\":";
+	appendJsonString(text, entry.test->getName());
+	text += ",\"scopedName\":";
+	appendJsonString(text, entry.test->getScopedName());
+	++index;
+
+	if(entry.isLazy)
+	{
+		text += ",\"isLazy\":true";
+	}
+	else if(entry.isSuite)
+	{
+		char count[32];
+		::sprintf(count, ",\"testCount\":%d", entry.testCount);
+		text += count;
+		if(! entry.isComplete)
+			text += ",\"isComplete\":false";
+		text += ",\"tests\":[";
+		bool first = true;
+		while(index < m_entries.size() && m_entries[index].depth > entry.depth)
+		{
+			text += first ? "\n" : ",\n";
+			text.append(2 * (entry.depth + 1), ' ');
+			index = writeJson(index, text);
+			first = false;
+		}
+		text += "]";
+	}
+
+	text += "}";
+	return index;
+}
+
+void TestListWriter::appendJsonString(std::string& text, const std::string& value)
+{
+	text += '"';
+	for(std::string::const_iterator it = value.begin(); it != value.end(); ++it)
+	{
+		unsigned char c = *it;
+		if(c == '"' || c == '\\')
+		{
+			text += '\\';
+			text += c;
+		}
+		else if(c < 0x20)
+		{
+			char escaped[8];
+			::sprintf(escaped, "\\u%04x", c);
+			text += escaped;
+		}
+		else
+		{
+			text += c;
+		}
+	}
+	text += '"';
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,229 @@
+#include <cppunit/plugin/TestManifest.h>
+
+#if !defined(CPPUNIT_NO_TESTPLUGIN)
+#include <cppunit/tools/MappedFile.h>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string.h>
+
+#if defined(__ELF__)
+#include <elf.h>
+#endif
+
+
+CPPUNIT_NS_BEGIN
+
+
+namespace
+{
+	const char manifestHeader[] = "CppUnit test manifest 1";
+
+#if defined(__ELF__)
+	/// Scans the note segments of an ELF file of the specified class for the GNU build-id.
+	template<class Header, class ProgramHeader>
+	std::string findBuildId(const char* data, size_t size)
+	{
+		if(size < sizeof(Header))
+			return "";
+		const Header* header = (const Header*)data;
+		if(header->e_phentsize != sizeof(ProgramHeader) || header->e_phoff > size
+			|| header->e_phnum > (size - header->e_phoff) / sizeof(ProgramHeader))
+			return "";
+
+		const ProgramHeader* segments = (const ProgramHeader*)(data + header->e_phoff);
+		for(unsigned int index = 0; index < header->e_phnum; ++index)
+		{
+			const ProgramHeader& segment = segments[index];
+			if(segment.p_type != PT_NOTE || segment.p_offset > size || segment.p_filesz > size - segment.p_offset)
+				continue;
+
+			// The note header has the same layout in both classes.
+			size_t offset = segment.p_offset;
+			size_t end = offset + segment.p_filesz;
+			while(end - offset >= sizeof(Elf32_Nhdr))
+			{
+				const Elf32_Nhdr* note = (const Elf32_Nhdr*)(data + offset);
+				size_t nameSize = (note->n_namesz + 3) & ~(size_t)3;
+				size_t descriptionSize = (note->n_descsz + 3) & ~(size_t)3;
+				offset += sizeof(Elf32_Nhdr);
+				if(nameSize > end - offset || descriptionSize > end - offset - nameSize)
+					break;
+
+				if(note->n_type == NT_GNU_BUILD_ID && note->n_namesz == 4 && ::memcmp(data + offset, "GNU", 4) == 0)
+				{
+					static const char digits[] = "0123456789abcdef";
+					const unsigned char* id = (const unsigned char*)(data + offset + nameSize);
+					std::string buildId;
+					for(unsigned int byte = 0; byte < note->n_descsz; ++byte)
+					{
+						buildId += digits[id[byte] >> 4];
+						buildId += digits[id[byte] & 0xf];
+					}
+					return buildId;
+				}
+				offset += nameSize + descriptionSize;
+			}
+		}
+		return "";
+	}
+#endif
+}
+
+
+TestManifest::TestManifest(const std::string& buildId)
+	: m_buildId(buildId)
+	, m_entries()
+	, m_indexes()
+{
+}
+
+TestManifest::~TestManifest()
+{
+}
+
+const std::string& TestManifest::buildId() const
+{
+	return m_buildId;
+}
+
+void TestManifest::setBuildId(const std::string& buildId)
+{
+	m_buildId = buildId;
+}
+
+const TestManifest::Entries& TestManifest::entries() const
+{
+	return m_entries;
+}
+
+void TestManifest::addTest(const std::string& suite, const std::string& name, unsigned long long duration)
+{
+	Entry entry;
+	entry.suite = suite;
+	entry.name = name;
+	entry.duration = duration;
+	m_indexes.insert(std::pair<const std::string, unsigned int>(name, m_entries.size()));
+	m_entries.push_back(entry);
+}
+
+bool TestManifest::setDuration(const std::string& name, unsigned long long duration)
+{
+	EntryIndexes::iterator it = m_indexes.find(name);
+	if(it == m_indexes.end())
+		return false;
+	m_entries[it->second].duration = duration;
+	return true;
+}
+
+void TestManifest::mergeDurations(const TestManifest& other)
+{
+	for(Entries::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		EntryIndexes::const_iterator index = other.m_indexes.find(it->name);
+		if(it->duration == 0 && index != other.m_indexes.end())
+			it->duration = other.m_entries[index->second].duration;
+	}
+}
+
+void TestManifest::clear()
+{
+	m_entries.clear();
+	m_indexes.clear();
+}
+
+bool TestManifest::read(const std::string& fileName)
+{
+	m_buildId.clear();
+	clear();
+
+	std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+	std::string line;
+	if(! std::getline(stream, line) || line != manifestHeader)
+		return false;
+
+	std::string suite;
+	while(std::getline(stream, line))
+	{
+		std::string::size_type separator = line.find('\t');
+		if(separator == std::string::npos)
+			continue;
+
+		std::string kind = line.substr(0, separator);
+		std::string value = line.substr(separator + 1);
+		if(kind == "build-id")
+		{
+			m_buildId = value;
+		}
+		else if(kind == "suite")
+		{
+			suite = value;
+		}
+		else if(kind == "test")
+		{
+			separator = value.find('\t');
+			if(separator == std::string::npos)
+				continue;
+			unsigned long long duration = 0;
+			std::istringstream(value.substr(0, separator)) >> duration;
+			addTest(suite, value.substr(separator + 1), duration);
+		}
+	}
+	return true;
+}
+
+void TestManifest::write(const std::string& fileName) const
+{
+	std::ostringstream text;
+	text << manifestHeader << '\n';
+	text << "build-id\t" << m_buildId << '\n';
+
+	const std::string* suite = NULL;
+	for(Entries::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		if(suite == NULL || *suite != it->suite)
+		{
+			text << "suite\t" << it->suite << '\n';
+			suite = &it->suite;
+		}
+		text << "test\t" << it->duration << '\t' << it->name << '\n';
+	}
+
+	std::ofstream stream(fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+	std::string content = text.str();
+	stream.write(content.data(), content.length());
+	if(! stream)
+		throw std::runtime_error("TestManifest: failed to write <" + fileName + ">");
+}
+
+std::string TestManifest::fileName(const std::string& libraryFileName)
+{
+	return libraryFileName + ".manifest";
+}
+
+std::string TestManifest::readBuildId(const std::string& libraryFileName)
+{
+#if defined(__ELF__)
+	try
+	{
+		MappedFile file(libraryFileName);
+		const char* data = file.data();
+		size_t size = file.size();
+		if(size < EI_NIDENT || ::memcmp(data, ELFMAG, SELFMAG) != 0)
+			return "";
+		if(data[EI_CLASS] == ELFCLASS64)
+			return findBuildId<Elf64_Ehdr, Elf64_Phdr>(data, size);
+		if(data[EI_CLASS] == ELFCLASS32)
+			return findBuildId<Elf32_Ehdr, Elf32_Phdr>(data, size);
+	}
+	catch(std::exception&)
+	{
+	}
+#endif
+	return "";
+}
+
+
+CPPUNIT_NS_END
+
+#endif // !defined(CPPUNIT_NO_TESTPLUGIN)
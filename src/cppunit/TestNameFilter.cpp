@@ -0,0 +1,180 @@
+#include <cppunit/TestNameFilter.h>
+#include <cppunit/Test.h>
+#include <cppunit/tools/RegularExpression.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+TestNameFilter::TestNameFilter(const std::string& patterns)
+	: m_positive()
+	, m_negative()
+	, m_scope()
+{
+	try
+	{
+		addPatterns(patterns);
+	}
+	catch(...)
+	{
+		clear();
+		throw;
+	}
+}
+
+TestNameFilter::~TestNameFilter()
+{
+	clear();
+}
+
+void TestNameFilter::clear()
+{
+	for(Patterns::iterator it = m_positive.begin(); it != m_positive.end(); ++it)
+		delete it->expression;
+	for(Patterns::iterator it = m_negative.begin(); it != m_negative.end(); ++it)
+		delete it->expression;
+	m_positive.clear();
+	m_negative.clear();
+}
+
+void TestNameFilter::addPatterns(const std::string& patterns)
+{
+	bool negative = false;
+	std::string::size_type begin = 0;
+	while(begin <= patterns.length())
+	{
+		// Find the next ':' that is not part of a "::".
+		std::string::size_type end = begin;
+		while(end < patterns.length())
+		{
+			if(patterns[end] == ':')
+			{
+				if(end + 1 < patterns.length() && patterns[end + 1] == ':')
+				{
+					end += 2;
+					continue;
+				}
+				break;
+			}
+			++end;
+		}
+
+		std::string text = patterns.substr(begin, end - begin);
+		begin = end + 1;
+
+		if(! text.empty() && text[0] == '-')
+		{
+			negative = true;
+			text.erase(0, 1);
+		}
+		if(text.empty())
+			continue;
+
+		Pattern pattern;
+		pattern.expression = NULL;
+		if(text.length() >= 2 && text[0] == '/' && text[text.length() - 1] == '/')
+			pattern.expression = new RegularExpression(text.substr(1, text.length() - 2));
+		else
+			pattern.glob = text;
+
+		(negative ? m_negative : m_positive).push_back(pattern);
+	}
+}
+
+void TestNameFilter::setScope(const std::string& scope)
+{
+	m_scope = scope;
+}
+
+bool TestNameFilter::matches(const std::string& name) const
+{
+	return (m_positive.empty() || matchesAny(m_positive, name)) && ! matchesAny(m_negative, name);
+}
+
+bool TestNameFilter::accept(Test* test) const
+{
+	if(m_positive.empty() && m_negative.empty())
+		return true;
+
+	std::string name = test->getName();
+	std::string scopedName = test->getScopedName();
+	std::string fullName = m_scope.empty() ? scopedName : m_scope + scopedName;
+	if(matchesAny(m_negative, name) || matchesAny(m_negative, scopedName) || matchesAny(m_negative, fullName))
+		return false;
+	return m_positive.empty() || matchesAny(m_positive, name) || matchesAny(m_positive, scopedName) || matchesAny(m_positive, fullName);
+}
+
+bool TestNameFilter::acceptPrefix(const std::string& prefix) const
+{
+	if(m_positive.empty())
+		return true;
+	return globAcceptsPrefix(prefix) || (! m_scope.empty() && globAcceptsPrefix(m_scope + prefix));
+}
+
+bool TestNameFilter::globAcceptsPrefix(const std::string& prefix) const
+{
+	for(Patterns::const_iterator it = m_positive.begin(); it != m_positive.end(); ++it)
+	{
+		if(it->expression)
+			return true;
+
+		// A name starting with the prefix can match only if the literal start
+		// of the glob and the prefix agree.
+		std::string::size_type literal = it->glob.find_first_of("*?");
+		if(literal == std::string::npos)
+		{
+			if(it->glob.length() < prefix.length())
+				continue;
+			literal = it->glob.length();
+		}
+		std::string::size_type length = literal < prefix.length() ? literal : prefix.length();
+		if(it->glob.compare(0, length, prefix, 0, length) == 0)
+			return true;
+	}
+	return false;
+}
+
+bool TestNameFilter::matchesAny(const Patterns& patterns, const std::string& name)
+{
+	for(Patterns::const_iterator it = patterns.begin(); it != patterns.end(); ++it)
+	{
+		if(it->expression ? it->expression->matches(name) : matchesGlob(it->glob, name))
+			return true;
+	}
+	return false;
+}
+
+bool TestNameFilter::matchesGlob(const std::string& glob, const std::string& name)
+{
+	// Backtracks to the last '*' only, which is enough for '*' and '?'.
+	std::string::size_type g = 0, n = 0;
+	std::string::size_type star = std::string::npos, resume = 0;
+	while(n < name.length())
+	{
+		if(g < glob.length() && (glob[g] == '?' || glob[g] == name[n]))
+		{
+			++g;
+			++n;
+		}
+		else if(g < glob.length() && glob[g] == '*')
+		{
+			star = g++;
+			resume = n;
+		}
+		else if(star != std::string::npos)
+		{
+			g = star + 1;
+			n = ++resume;
+		}
+		else
+		{
+			return false;
+		}
+	}
+	while(g < glob.length() && glob[g] == '*')
+		++g;
+	return g == glob.length();
+}
+
+
+CPPUNIT_NS_END
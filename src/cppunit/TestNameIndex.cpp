@@ -0,0 +1,185 @@
+#include <cppunit/Test.h>
+#include <cppunit/TestPath.h>
+#include "TestNameIndex.h"
+
+
+CPPUNIT_NS_BEGIN
+
+
+TestNameIndex::TestNameIndex()
+	: m_root(NULL)
+	, m_nodes()
+	, m_names()
+	, m_scopedNames()
+	, m_deferred()
+{
+}
+
+bool TestNameIndex::find(Test* root, const std::string& name, TestPath& testPath)
+{
+	bool isBuilt = false;
+	if(m_root != root)
+	{
+		build(root);
+		isBuilt = true;
+	}
+
+	TestPath deferredPath;
+	int node = lookup(name, deferredPath);
+	if(node < 0 && ! isBuilt)
+	{
+		// The test may have been added or moved since the index was built.
+		build(root);
+		node = lookup(name, deferredPath);
+	}
+	if(node < 0)
+		return false;
+
+	int index = testPath.getTestCount();
+	testPath.add(deferredPath);
+	for(; node >= 0; node = m_nodes[node].parent)
+		testPath.insert(m_nodes[node].test, index);
+	return true;
+}
+
+void TestNameIndex::invalidate()
+{
+	m_root = NULL;
+}
+
+void TestNameIndex::build(Test* root)
+{
+	m_nodes.clear();
+	m_names.clear();
+	m_scopedNames.clear();
+	m_deferred.clear();
+
+	addNode(root, -1, 0);
+	m_root = root;
+}
+
+int TestNameIndex::lookup(const std::string& name, TestPath& deferredPath) const
+{
+	int node = m_names.lookup(name);
+	if(node < 0)
+		node = m_scopedNames.lookup(name);
+	if(node < 0)
+		node = findDeferred(name, deferredPath);
+	if(node < 0 || ! isValid(node))
+	{
+		deferredPath = TestPath();
+		return -1;
+	}
+	return node;
+}
+
+bool TestNameIndex::isValid(int node) const
+{
+	CppUnitVector<int> chain;
+	for(; node >= 0; node = m_nodes[node].parent)
+		chain.push_back(node);
+
+	// Checked from the root down: a test is only used once found in its live parent.
+	for(int index = (int)chain.size() - 2; index >= 0; --index)
+	{
+		const Node& child = m_nodes[chain[index]];
+		Test* parent = m_nodes[child.parent].test;
+		if(child.childIndex >= parent->getChildTestCount() || parent->getChildTestAt(child.childIndex) != child.test)
+			return false;
+	}
+	return true;
+}
+
+void TestNameIndex::addNode(Test* test, int parent, int childIndex)
+{
+	Node node = { test, parent, childIndex };
+	int index = m_nodes.size();
+	m_nodes.push_back(node);
+
+	m_names.insert(test->getName(), index);
+	m_scopedNames.insert(test->getScopedName(), index);
+
+	if(parent >= 0 && ! test->getTestNamePrefix().empty())
+	{
+		m_deferred.push_back(index);
+		return;
+	}
+
+	int childCount = test->getChildTestCount();
+	for(int child = 0; child < childCount; ++child)
+		addNode(test->getChildTestAt(child), index, child);
+}
+
+int TestNameIndex::findDeferred(const std::string& name, TestPath& testPath) const
+{
+	for(CppUnitVector<int>::const_iterator it = m_deferred.begin(); it != m_deferred.end(); ++it)
+	{
+		Test* test = m_nodes[*it].test;
+		TestPath path;
+		if(test->findTestPath(name, path))
+		{
+			// The deferred test itself is inserted with its parents by find().
+			testPath.add(TestPath(path, 1));
+			return *it;
+		}
+	}
+	return -1;
+}
+
+void TestNameIndex::Table::clear()
+{
+	m_buckets.clear();
+	m_buckets.resize(64);
+	m_size = 0;
+}
+
+void TestNameIndex::Table::insert(const std::string& key, int node)
+{
+	if(lookup(key) >= 0)
+		return;
+
+	if(m_size >= m_buckets.size())
+	{
+		CppUnitVector<Bucket> buckets(m_buckets.size() * 4);
+		for(unsigned int bucket = 0; bucket < m_buckets.size(); ++bucket)
+		{
+			for(Bucket::const_iterator it = m_buckets[bucket].begin(); it != m_buckets[bucket].end(); ++it)
+				buckets[hash(it->key) % buckets.size()].push_back(*it);
+		}
+		m_buckets.swap(buckets);
+	}
+
+	Entry entry;
+	entry.key = key;
+	entry.node = node;
+	m_buckets[hash(key) % m_buckets.size()].push_back(entry);
+	++m_size;
+}
+
+int TestNameIndex::Table::lookup(const std::string& key) const
+{
+	if(m_buckets.empty())
+		return -1;
+
+	const Bucket& bucket = m_buckets[hash(key) % m_buckets.size()];
+	for(Bucket::const_iterator it = bucket.begin(); it != bucket.end(); ++it)
+	{
+		if(it->key == key)
+			return it->node;
+	}
+	return -1;
+}
+
+size_t TestNameIndex::Table::hash(const std::string& key)
+{
+	size_t hash = 2166136261u;
+	for(std::string::const_iterator it = key.begin(); it != key.end(); ++it)
+	{
+		hash ^= (unsigned char)*it;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,103 @@
+#ifndef CPPUNIT_TESTNAMEINDEX_H
+#define CPPUNIT_TESTNAMEINDEX_H
+
+#include <cppunit/Portability.h>
+#include <cppunit/portability/CppUnitVector.h>
+#include <string>
+
+CPPUNIT_NS_BEGIN
+
+class Test;
+class TestPath;
+
+
+/*! \brief Hash index of the names of the tests of a hierarchy (Implementation).
+ *
+ * Implementation detail.
+ * \internal Maps the name and the scoped name of each test below the root to
+ * its position in the hierarchy. When several tests have the same name, the
+ * first one in depth-first order is kept, like Test::findTestPath() does.
+ *
+ * The children of a test that has a name prefix (see Test::getTestNamePrefix())
+ * are not indexed, so that they are not built: a name that is not in the
+ * index is searched in the deferred tests whose prefix it starts with.
+ *
+ * The index is kept by the root of the hierarchy (see TestRunner). A test
+ * found in the index is checked against the hierarchy, from the test up to the
+ * root, so that a test removed or moved since the index was built is not
+ * returned. A name that is not found, or whose test was moved, rebuilds the
+ * index once, in case it was added since: changes made below the root do not
+ * need to invalidate it. Like the hierarchy, the index is not thread safe.
+ */
+class TestNameIndex
+{
+public:
+	TestNameIndex();
+
+	/*! \brief Finds the test with the specified name or scoped name.
+	 * \param root Root of the indexed hierarchy.
+	 * \param name Name or scoped name of the test.
+	 * \param testPath Receives the path from \a root to the test, if found.
+	 * \return \c true if the test was found.
+	 */
+	bool find(Test* root, const std::string& name, TestPath& testPath);
+
+	/// Invalidates the index: the next lookup rebuilds it.
+	void invalidate();
+
+private:
+	struct Node
+	{
+		Test* test;
+		int   parent;
+		int   childIndex;   ///< Index of the test in its parent.
+	};
+
+	/// Hash table of node indexes by name. The first node inserted for a name is kept.
+	class Table
+	{
+	public:
+		Table()
+			: m_buckets()
+			, m_size(0)
+		{
+		}
+
+		void clear();
+		void insert(const std::string& key, int node);
+		int lookup(const std::string& key) const;
+
+	private:
+		struct Entry
+		{
+			std::string key;
+			int         node;
+		};
+
+		typedef CppUnitVector<Entry> Bucket;
+
+		static size_t hash(const std::string& key);
+
+	private:
+		CppUnitVector<Bucket> m_buckets;
+		size_t                m_size;
+	};
+
+	void build(Test* root);
+	void addNode(Test* test, int parent, int childIndex);
+	int lookup(const std::string& name, TestPath& deferredPath) const;
+	int findDeferred(const std::string& name, TestPath& testPath) const;
+	bool isValid(int node) const;
+
+private:
+	Test*               m_root;
+	CppUnitVector<Node> m_nodes;
+	Table               m_names;
+	Table               m_scopedNames;
+	CppUnitVector<int>  m_deferred;
+};
+
+
+CPPUNIT_NS_END
+
+#endif // CPPUNIT_TESTNAMEINDEX_H
@@ -0,0 +1,375 @@
+#include <cppunit/TestOrder.h>
+#include <cppunit/Test.h>
+#include <cppunit/TestComposite.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/tools/Clock.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <stdlib.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+namespace
+{
+	const char* const header = "CppUnit test order 2";
+
+	/// Chance of failure of a test case that did not fail recently.
+	const double baseScore = 1.0 / 1024;
+
+	/// Runs the units of an ordered test, without owning them.
+	class OrderedTest : public TestComposite
+	{
+	public:
+		OrderedTest(const std::string& name)
+			: TestComposite(name)
+			, m_tests()
+		{
+		}
+
+		void addTest(Test* test)
+		{
+			m_tests.push_back(test);
+		}
+
+		int getChildTestCount() const
+		{
+			return m_tests.size();
+		}
+
+	protected:
+		Test* doGetChildTestAt(int index) const
+		{
+			return m_tests[index];
+		}
+
+	private:
+		CppUnitVector<Test*> m_tests;
+	};
+
+	struct HigherScore
+	{
+		template<typename Unit>
+		bool operator()(const Unit& first, const Unit& second) const
+		{
+			return first.score > second.score;
+		}
+	};
+
+	struct HigherValueBySecond
+	{
+		template<typename Unit>
+		bool operator()(const Unit& first, const Unit& second) const
+		{
+			return first.value * second.cost > second.value * first.cost;
+		}
+	};
+}
+
+
+TestOrder::TestOrder(const std::string& fileName, const std::string& binaryId, Mode mode)
+	: m_fileName(fileName)
+	, m_binaryId(binaryId)
+	, m_mode(mode)
+	, m_run(1)
+	, m_change(0)
+	, m_entries()
+	, m_orderedTests()
+	, m_hasTimeBudget(false)
+	, m_isTimeBudgetIgnored(false)
+	, m_timeBudget(0)
+	, m_deferred()
+	, m_hasFailed(false)
+	, m_startTime(0)
+{
+	std::ifstream stream(m_fileName.c_str(), std::ios::in | std::ios::binary);
+	std::string line;
+	if(! std::getline(stream, line) || line != header)
+		return;
+
+	while(std::getline(stream, line))
+	{
+		std::istringstream fields(line);
+		std::string kind;
+		std::getline(fields, kind, '\t');
+		if(kind == "run")
+		{
+			std::string run, change, recordedId;
+			std::getline(fields, run, '\t');
+			std::getline(fields, change, '\t');
+			std::getline(fields, recordedId);
+			m_run = ::strtoul(run.c_str(), NULL, 10) + 1;
+			m_change = ::strtoul(change.c_str(), NULL, 10);
+			if(recordedId != m_binaryId)
+				++m_change;
+		}
+		else if(kind == "test")
+		{
+			std::string outcomes, lastFailedRun, firstChange, duration, name;
+			std::getline(fields, outcomes, '\t');
+			std::getline(fields, lastFailedRun, '\t');
+			std::getline(fields, firstChange, '\t');
+			std::getline(fields, duration, '\t');
+			std::getline(fields, name);
+			Entry& entry = m_entries[name];
+			entry.outcomes = ::strtoul(outcomes.c_str(), NULL, 16);
+			entry.lastFailedRun = ::strtoul(lastFailedRun.c_str(), NULL, 10);
+			entry.firstChange = ::strtoul(firstChange.c_str(), NULL, 10);
+			entry.duration = ::strtoull(duration.c_str(), NULL, 10);
+		}
+	}
+}
+
+TestOrder::~TestOrder()
+{
+	for(CppUnitVector<Test*>::iterator it = m_orderedTests.begin(); it != m_orderedTests.end(); ++it)
+		delete *it;
+}
+
+Test* TestOrder::order(Test* test, TestResult* controller)
+{
+	Units units;
+	addUnits(test, controller, units);
+	if(m_hasTimeBudget)
+		selectUnits(units);
+	std::stable_sort(units.begin(), units.end(), HigherScore());
+
+	OrderedTest* ordered = new OrderedTest(test->getName());
+	m_orderedTests.push_back(ordered);
+	for(Units::const_iterator it = units.begin(); it != units.end(); ++it)
+		ordered->addTest(it->test);
+	return ordered;
+}
+
+double TestOrder::score(const std::string& testName) const
+{
+	if(m_mode == likelyFail)
+		return failureScore(testName);
+
+	Entries::const_iterator it = m_entries.find(testName);
+	if(it == m_entries.end() || (it->second.outcomes & 1) == 0)
+		return 0;
+	return it->second.lastFailedRun;
+}
+
+void TestOrder::setTimeBudget(unsigned long long microseconds)
+{
+	m_hasTimeBudget = microseconds > 0;
+	m_timeBudget = microseconds;
+}
+
+const CppUnitVector<std::string>& TestOrder::deferredTests() const
+{
+	return m_deferred;
+}
+
+void TestOrder::writeDeferred(OStream& stream) const
+{
+	if(m_isTimeBudgetIgnored)
+	{
+		stream << "Time budget not applied: no test duration recorded in <" << m_fileName << "> yet\n";
+		stream.flush();
+	}
+	if(m_deferred.empty())
+		return;
+
+	stream << "Deferred over the time budget: " << m_deferred.size() << "\n";
+	for(unsigned int index = 0; index < m_deferred.size(); ++index)
+		stream << "  deferred: " << m_deferred[index] << "\n";
+	stream.flush();
+}
+
+void TestOrder::startTest(Test*)
+{
+	m_hasFailed = false;
+	m_startTime = Clock::microseconds();
+}
+
+void TestOrder::addFailure(const TestFailure&)
+{
+	m_hasFailed = true;
+}
+
+void TestOrder::endTest(Test* test)
+{
+	unsigned long long duration = Clock::microseconds() - m_startTime;
+	std::string name = test->getScopedName();
+	Entries::iterator it = m_entries.find(name);
+	if(it == m_entries.end())
+	{
+		Entry entry;
+		entry.outcomes = 0;
+		entry.lastFailedRun = 0;
+		entry.firstChange = m_change;
+		entry.duration = 0;
+		it = m_entries.insert(std::make_pair(name, entry)).first;
+	}
+
+	Entry& entry = it->second;
+	entry.outcomes = (entry.outcomes << 1) | (m_hasFailed ? 1 : 0);
+	if(m_hasFailed)
+		entry.lastFailedRun = m_run;
+	entry.duration = duration;
+	m_hasFailed = false;
+}
+
+double TestOrder::failureScore(const std::string& testName) const
+{
+	Entries::const_iterator it = m_entries.find(testName);
+
+	// Not recorded yet: as new as a test added by this build.
+	if(it == m_entries.end())
+		return 1;
+
+	double score = 0;
+	double weight = 1;
+	for(unsigned int outcomes = it->second.outcomes; outcomes != 0; outcomes >>= 1)
+	{
+		if(outcomes & 1)
+			score += weight;
+		weight /= 2;
+	}
+
+	// The test cases of the first recorded build are not new.
+	if(it->second.firstChange > 0)
+	{
+		double bonus = 1;
+		for(unsigned int change = it->second.firstChange; change < m_change && bonus > 0; ++change)
+			bonus /= 2;
+		score += bonus;
+	}
+	return score;
+}
+
+void TestOrder::write() const
+{
+	std::ostringstream text;
+	text << header << '\n';
+	text << "run\t" << m_run << '\t' << m_change << '\t' << m_binaryId << '\n';
+	for(Entries::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+	{
+		text << "test\t" << std::hex << it->second.outcomes << std::dec
+			<< '\t' << it->second.lastFailedRun
+			<< '\t' << it->second.firstChange
+			<< '\t' << it->second.duration
+			<< '\t' << it->first << '\n';
+	}
+
+	std::ofstream stream(m_fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+	std::string content = text.str();
+	if(! stream.write(content.data(), content.length()) || ! stream.flush())
+		throw std::runtime_error("TestOrder: failed to write <" + m_fileName + ">");
+}
+
+void TestOrder::addUnits(Test* test, TestResult* controller, Units& units) const
+{
+	// Skips the suites that can be rejected by name without being made.
+	if(controller != NULL && ! test->getTestNamePrefix().empty() && ! controller->shouldRun(test))
+		return;
+
+	int childCount = test->getChildTestCount();
+	if(childCount == 0 || test->keepsChildTestsGrouped())
+	{
+		// Rejected test cases neither run nor use the time budget.
+		if(controller != NULL && ! controller->shouldRun(test))
+			return;
+
+		Unit unit;
+		unit.test = test;
+		unit.index = units.size();
+		unit.score = maxScore(test, false);
+		unit.value = maxScore(test, true) + baseScore;
+		unit.cost = 0;
+		units.push_back(unit);
+		return;
+	}
+
+	for(int child = 0; child < childCount; ++child)
+		addUnits(test->getChildTestAt(child), controller, units);
+}
+
+void TestOrder::selectUnits(Units& units)
+{
+	// Without any recorded duration, the cost of the test cases is unknown:
+	// they are all run, to record their durations.
+	if(m_entries.empty())
+	{
+		m_isTimeBudgetIgnored = true;
+		return;
+	}
+
+	// The test cases not recorded yet are expected to last the average duration.
+	unsigned long long unknownDuration = 0;
+	for(Entries::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+		unknownDuration += it->second.duration;
+	unknownDuration /= m_entries.size();
+	for(Units::iterator it = units.begin(); it != units.end(); ++it)
+		it->cost = std::max(cost(it->test, unknownDuration), 1ULL);
+
+	// Greedy knapsack: the highest chance of failure by second first, while it fits.
+	Units ranked(units);
+	std::stable_sort(ranked.begin(), ranked.end(), HigherValueBySecond());
+	CppUnitVector<bool> isSelected(units.size(), false);
+	for(Units::const_iterator it = ranked.begin(); it != ranked.end(); ++it)
+	{
+		if(it->cost <= m_timeBudget)
+		{
+			m_timeBudget -= it->cost;
+			isSelected[it->index] = true;
+		}
+		else
+		{
+			addDeferred(it->test);
+		}
+	}
+
+	Units selected;
+	for(Units::const_iterator it = units.begin(); it != units.end(); ++it)
+	{
+		if(isSelected[it->index])
+			selected.push_back(*it);
+	}
+	units.swap(selected);
+}
+
+void TestOrder::addDeferred(Test* test)
+{
+	int childCount = test->getChildTestCount();
+	if(childCount == 0)
+		m_deferred.push_back(test->getScopedName());
+	for(int child = 0; child < childCount; ++child)
+		addDeferred(test->getChildTestAt(child));
+}
+
+double TestOrder::maxScore(Test* test, bool isFailureScore) const
+{
+	int childCount = test->getChildTestCount();
+	if(childCount == 0)
+		return isFailureScore ? failureScore(test->getScopedName()) : score(test->getScopedName());
+
+	double max = 0;
+	for(int child = 0; child < childCount; ++child)
+		max = std::max(max, maxScore(test->getChildTestAt(child), isFailureScore));
+	return max;
+}
+
+unsigned long long TestOrder::cost(Test* test, unsigned long long unknownDuration) const
+{
+	int childCount = test->getChildTestCount();
+	if(childCount == 0)
+	{
+		Entries::const_iterator it = m_entries.find(test->getScopedName());
+		return it == m_entries.end() ? unknownDuration : it->second.duration;
+	}
+
+	unsigned long long total = 0;
+	for(int child = 0; child < childCount; ++child)
+		total += cost(test->getChildTestAt(child), unknownDuration);
+	return total;
+}
+
+
+CPPUNIT_NS_END
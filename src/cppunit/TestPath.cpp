@@ -46,6 +46,16 @@ TestPath::TestPath(Test* searchRoot, const std::string& pathAsString)
 {
 	PathTestNames testNames;
 
+	// A scoped name such as "Fixture::test" is first looked up as a whole, so
+	// that a root with a name index resolves it without scanning each level.
+	if(pathAsString.find('/') == std::string::npos)
+	{
+		splitPathString(pathAsString, testNames);
+		if(testNames.size() > 1 && findScopedName(searchRoot, pathAsString, testNames.size()))
+			return;
+		testNames.clear();
+	}
+
 	Test* parentTest = findActualRoot(searchRoot, pathAsString, testNames);
 	add(parentTest);
 
@@ -189,6 +199,17 @@ Test* TestPath::findActualRoot(Test* searchRoot, const std::string& pathAsString
 	return root;
 }
 
+bool TestPath::findScopedName(Test* searchRoot, const std::string& scopedName, int testCount)
+{
+	TestPath path;
+	if(! searchRoot->findTestPath(scopedName, path) || path.getTestCount() < testCount)
+		return false;
+
+	// Keeps the tests named by the path, as when resolving it level by level.
+	add(TestPath(path, path.getTestCount() - testCount));
+	return true;
+}
+
 bool TestPath::splitPathString(const std::string& pathAsString, PathTestNames& testNames)
 {
 	if(pathAsString.empty())
@@ -0,0 +1,61 @@
+#include <cppunit/Exception.h>
+#include <cppunit/Message.h>
+#include <cppunit/SourceLine.h>
+#include <cppunit/TestFailure.h>
+#include <cppunit/TestRecord.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+TestRecord::TestRecord()
+	: name()
+	, status(success)
+	, duration(0)
+	, fileName()
+	, lineNumber(-1)
+	, shortDescription()
+	, details()
+	, capturedOutput()
+{
+}
+
+void TestRecord::setFailure(const TestFailure& failure)
+{
+	if(isFailure())
+		return;
+
+	Exception* thrownException = failure.thrownException();
+	Message message = thrownException->message();
+	SourceLine sourceLine = failure.sourceLine();
+
+	status = failure.isError() ? error : TestRecord::failure;
+	fileName = sourceLine.fileName();
+	lineNumber = sourceLine.isValid() ? sourceLine.lineNumber() : -1;
+	shortDescription = message.shortDescription();
+	details.clear();
+	for(int index = 0; index < message.detailCount(); ++index)
+		details.push_back(message.detailAt(index));
+	capturedOutput = failure.capturedOutput();
+}
+
+Exception* TestRecord::makeException() const
+{
+	Message message(shortDescription);
+	for(unsigned int index = 0; index < details.size(); ++index)
+		message.addDetail(details[index]);
+
+	SourceLine sourceLine;
+	if(lineNumber >= 0)
+		sourceLine = SourceLine(fileName, lineNumber);
+
+	return new Exception(message, sourceLine);
+}
+
+bool TestRecord::isFailure() const
+{
+	return status == failure || status == error;
+}
+
+
+CPPUNIT_NS_END
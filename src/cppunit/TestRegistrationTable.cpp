@@ -0,0 +1,123 @@
+#include <cppunit/extensions/TestRegistrationTable.h>
+#include <cppunit/TestSuite.h>
+#include <cppunit/portability/CppUnitMap.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+#if defined(CPPUNIT_HAVE_TEST_SECTION)
+
+// Defined by the linker when the section is not empty.
+extern "C" const TestRegistration* const __start_cppunit_tests[] __attribute__((weak, visibility("hidden")));
+extern "C" const TestRegistration* const __stop_cppunit_tests[] __attribute__((weak, visibility("hidden")));
+
+namespace
+{
+	class Registrations
+	{
+	public:
+		Registrations() : m_current(__start_cppunit_tests) {}
+		const TestRegistration* next()
+		{
+			while(m_current != NULL && m_current < __stop_cppunit_tests)
+			{
+				const TestRegistration* registration = *m_current++;
+				if(registration != NULL)
+					return registration;
+			}
+			return NULL;
+		}
+	private:
+		const TestRegistration* const* m_current;
+	};
+}
+
+#else
+
+const TestRegistrationLink* TestRegistrationLink::s_first = NULL;
+TestRegistrationLink* TestRegistrationLink::s_last = NULL;
+
+TestRegistrationLink::TestRegistrationLink(const TestRegistration* registration)
+	: m_registration(registration)
+	, m_next(NULL)
+{
+	if(s_last == NULL)
+		s_first = this;
+	else
+		s_last->m_next = this;
+	s_last = this;
+}
+
+namespace
+{
+	class Registrations
+	{
+	public:
+		Registrations() : m_current(TestRegistrationLink::s_first) {}
+		const TestRegistration* next()
+		{
+			if(m_current == NULL)
+				return NULL;
+			const TestRegistration* registration = m_current->m_registration;
+			m_current = m_current->m_next;
+			return registration;
+		}
+	private:
+		const TestRegistrationLink* m_current;
+	};
+}
+
+#endif
+
+
+TestRegistrationTable::TestRegistrationTable(const std::string& name)
+	: m_name(name)
+{
+}
+
+TestRegistrationTable::~TestRegistrationTable()
+{
+}
+
+Test* TestRegistrationTable::makeTest()
+{
+	typedef CppUnitMap<std::string, TestSuite*, std::less<std::string> > Suites;
+	Suites suites;
+
+	TestSuite* root = new TestSuite(m_name);
+	TestSuite* suite = NULL;
+
+	Registrations registrations;
+	while(const TestRegistration* registration = registrations.next())
+	{
+		if(suite == NULL || suite->getName() != registration->fixtureName)
+		{
+			Suites::iterator it = suites.find(registration->fixtureName);
+			if(it == suites.end())
+			{
+				suite = new TestSuite(registration->fixtureName);
+				root->addTest(suite);
+				suites.insert(std::pair<const std::string, TestSuite*>(registration->fixtureName, suite));
+			}
+			else
+			{
+				suite = it->second;
+			}
+		}
+		suite->addTest(registration->makeTest(registration->testName));
+	}
+	return root;
+}
+
+int TestRegistrationTable::testCount()
+{
+	int count = 0;
+	Registrations registrations;
+	while(registrations.next() != NULL)
+		++count;
+	return count;
+}
+
+
+CPPUNIT_NS_END
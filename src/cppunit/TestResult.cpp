@@ -1,10 +1,14 @@
+#include <cppunit/Exception.h>
 #include <cppunit/Test.h>
 #include <cppunit/TestFailure.h>
+#include <cppunit/TestFilter.h>
 #include <cppunit/TestListener.h>
 #include <cppunit/TestResult.h>
 #include <cppunit/tools/Algorithm.h>
+#include <cppunit/tools/OutputCapture.h>
 #include <cppunit/portability/Stream.h>
 #include <algorithm>
+#include <stdexcept>
 #include "DefaultProtector.h"
 #include "ProtectorChain.h"
 #include "ProtectorContext.h"
@@ -15,8 +19,12 @@ CPPUNIT_NS_BEGIN
 TestResult::TestResult( SynchronizationObject *syncObject )
     : SynchronizedObject( syncObject )
     , m_listeners()
+    , m_filters()
+    , m_capturedFailures()
+    , m_capture( 0 )
     , m_protectorChain( new ProtectorChain )
     , m_stop( false )
+    , m_stopOnFailure( false )
 { 
   m_protectorChain->push( new DefaultProtector() );
 }
@@ -24,6 +32,10 @@ TestResult::TestResult( SynchronizationObject *syncObject )
 
 TestResult::~TestResult()
 {
+  for ( TestFailures::iterator it = m_capturedFailures.begin();
+        it != m_capturedFailures.end();
+        ++it )
+    (*it)->release();
   stdCOut().flush();
   stdCErr().flush();
   delete m_protectorChain;
@@ -42,16 +54,18 @@ void
 TestResult::addError( Test *test, 
                       Exception *e )
 { 
-  TestFailure failure( test, e, true );
-  addFailure( failure );
+  TestFailure *failure = TestFailure::create( test, e, true );
+  addFailure( *failure );
+  failure->release();
 }
 
 
 void 
 TestResult::addFailure( Test *test, Exception *e )
 { 
-  TestFailure failure( test, e, false );
-  addFailure( failure );
+  TestFailure *failure = TestFailure::create( test, e, false );
+  addFailure( *failure );
+  failure->release();
 }
 
 
@@ -59,6 +73,19 @@ void
 TestResult::addFailure( const TestFailure &failure )
 {
   ExclusiveZone zone( m_syncObject ); 
+  if ( m_capture  &&  m_capture->isCapturing() )
+    m_capturedFailures.push_back( failure.share() );
+  else
+    reportFailure( failure );
+}
+
+
+void 
+TestResult::reportFailure( const TestFailure &failure )
+{
+  if ( m_stopOnFailure )
+    m_stop = true;
+
   for ( TestListeners::iterator it = m_listeners.begin();
         it != m_listeners.end(); 
         ++it )
@@ -74,6 +101,23 @@ TestResult::startTest( Test *test )
         it != m_listeners.end(); 
         ++it )
     (*it)->startTest( test );
+
+  if ( m_capture )
+  {
+    try
+    {
+      m_capture->start();
+    }
+    catch ( std::exception &e )
+    {
+      // The test runs uncaptured, its failures are reported as they occur.
+      TestFailure *failure = TestFailure::create( test, 
+                                                  new Exception( Message( "output capture failed", e.what() ) ),
+                                                  true );
+      reportFailure( *failure );
+      failure->release();
+    }
+  }
 }
 
   
@@ -81,6 +125,23 @@ void
 TestResult::endTest( Test *test )
 { 
   ExclusiveZone zone( m_syncObject ); 
+  if ( m_capture  &&  m_capture->isCapturing() )
+  {
+    std::string output = m_capture->stop();
+    TestFailures failures;
+    failures.swap( m_capturedFailures );
+    for ( TestFailures::iterator it = failures.begin(); 
+          it != failures.end(); 
+          ++it )
+    {
+      // The reporter of the failure may still hold a reference to it.
+      TestFailure *failure = (*it)->unshare();
+      failure->setCapturedOutput( output );
+      reportFailure( *failure );
+      failure->release();
+    }
+  }
+
   for ( TestListeners::iterator it = m_listeners.begin();
         it != m_listeners.end(); 
         ++it )
@@ -126,6 +187,14 @@ TestResult::stop()
 }
 
 
+void 
+TestResult::stopOnFailure( bool doStop )
+{
+  ExclusiveZone zone( m_syncObject );
+  m_stopOnFailure = doStop;
+}
+
+
 void 
 TestResult::addListener( TestListener *listener )
 {
@@ -142,6 +211,98 @@ TestResult::removeListener ( TestListener *listener )
 }
 
 
+void 
+TestResult::setOutputCapture( OutputCapture *capture )
+{
+  ExclusiveZone zone( m_syncObject ); 
+  m_capture = capture;
+}
+
+
+void 
+TestResult::addFilter( TestFilter *filter )
+{
+  ExclusiveZone zone( m_syncObject ); 
+  m_filters.push_back( filter );
+}
+
+
+void 
+TestResult::removeFilter( TestFilter *filter )
+{
+  ExclusiveZone zone( m_syncObject ); 
+  removeFromSequence( m_filters, filter );
+}
+
+
+bool 
+TestResult::hasFilters() const
+{
+  ExclusiveZone zone( m_syncObject ); 
+  return !m_filters.empty();
+}
+
+
+bool 
+TestResult::shouldRun( Test *test ) const
+{
+  ExclusiveZone zone( m_syncObject ); 
+  return m_filters.empty()  ||  isSelected( test );
+}
+
+
+bool 
+TestResult::isSelected( Test *test ) const
+{
+  std::string prefix = test->getTestNamePrefix();
+  if ( !prefix.empty() )
+  {
+    for ( TestFilters::const_iterator it = m_filters.begin();
+          it != m_filters.end(); 
+          ++it )
+    {
+      if ( !(*it)->acceptPrefix( prefix ) )
+        return false;
+    }
+  }
+
+  // A suite made only when needed is selected from its description, if any.
+  Test *described = test->getDescription();
+  if ( described == NULL )
+    described = test;
+
+  int childCount = 0;
+  try
+  {
+    childCount = described->getChildTestCount();
+  }
+  catch ( ... )
+  {
+    // A suite that fails to be made is run, to report the error (see LazyTestSuite::run()).
+    return true;
+  }
+
+  if ( childCount > 0 )
+  {
+    for ( int index = 0; index < childCount; ++index )
+    {
+      if ( isSelected( described->getChildTestAt( index ) ) )
+        return true;
+    }
+    return false;
+  }
+
+  for ( TestFilters::const_iterator it = m_filters.begin();
+        it != m_filters.end(); 
+        ++it )
+  {
+    if ( !(*it)->accept( test ) )
+      return false;
+  }
+  return true;
+}
+
+
 void 
 TestResult::runTest( Test *test )
 {
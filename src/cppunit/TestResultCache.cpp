@@ -0,0 +1,301 @@
+#include <cppunit/TestResultCache.h>
+#include <cppunit/Test.h>
+#include <cppunit/TestFailure.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/plugin/TestManifest.h>
+#include <cppunit/tools/Clock.h>
+#include <errno.h>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+
+CPPUNIT_NS_BEGIN
+
+
+namespace
+{
+	/// Finds the value of a property of the suite named \a suiteName, making
+	/// only the lazy suites that may contain it.
+	std::string findProperty(CPPUNIT_NS::Test* test, const std::string& suiteName, const std::string& key)
+	{
+		if(test->getName() == suiteName)
+		{
+			std::string value = test->getProperty(key);
+			if(! value.empty())
+				return value;
+		}
+
+		std::string prefix = test->getTestNamePrefix();
+		if((suiteName + "::").compare(0, prefix.length(), prefix) != 0)
+			return std::string();
+
+		int childCount = test->getChildTestCount();
+		for(int child = 0; child < childCount; ++child)
+		{
+			std::string value = findProperty(test->getChildTestAt(child), suiteName, key);
+			if(! value.empty())
+				return value;
+		}
+		return std::string();
+	}
+
+	bool isAbsolute(const std::string& path)
+	{
+#ifdef _WIN32
+		if(path.length() >= 2 && path[1] == ':')
+			return true;
+		if(! path.empty() && path[0] == '\\')
+			return true;
+#endif
+		return ! path.empty() && path[0] == '/';
+	}
+
+	std::string workingDirectory()
+	{
+		char buffer[4096];
+#ifdef _WIN32
+		if(! ::_getcwd(buffer, sizeof(buffer)))
+#else
+		if(! ::getcwd(buffer, sizeof(buffer)))
+#endif
+			return ".";
+		return buffer;
+	}
+
+	/// 64 bits FNV-1a hash, as TestJournal::testId().
+	void hash(unsigned long long& value, const char* data, size_t size)
+	{
+		for(size_t index = 0; index < size; ++index)
+		{
+			value ^= (unsigned char)data[index];
+			value *= 1099511628211ULL;
+		}
+	}
+
+	void hash(unsigned long long& value, const std::string& text)
+	{
+		hash(value, text.data(), text.length());
+		hash(value, "", 1);
+	}
+
+	std::string toHex(unsigned long long value)
+	{
+		char text[17];
+		::sprintf(text, "%016llx", value);
+		return text;
+	}
+
+	const unsigned long long hashBasis = 14695981039346656037ULL;
+}
+
+
+TestResultCache::TestResultCache(const std::string& directory, const std::string& binaryId, Test* tests, TestResultCollector* collector)
+	: m_fileName(directory + "/results.txt")
+	, m_binaryId(binaryId)
+	, m_tests(tests)
+	, m_workingDirectory(workingDirectory())
+	, m_collector(collector)
+	, m_entries()
+	, m_inputFiles()
+	, m_fileHashes()
+	, m_skipped()
+	, m_skippedTests()
+	, m_key()
+	, m_hasFailed(false)
+	, m_startTime(0)
+{
+#ifdef _WIN32
+	int result = ::_mkdir(directory.c_str());
+#else
+	int result = ::mkdir(directory.c_str(), 0755);
+#endif
+	if(result != 0 && errno != EEXIST)
+		throw std::runtime_error("TestResultCache: failed to create <" + directory + ">");
+
+	read();
+}
+
+TestResultCache::~TestResultCache()
+{
+}
+
+bool TestResultCache::accept(Test* test) const
+{
+	Entries::const_iterator it = m_entries.find(keyOf(test));
+	if(it == m_entries.end())
+		return true;
+
+	if(m_skippedTests.insert(test).second)
+		m_skipped.push_back(std::make_pair(test, it->second.duration));
+	return false;
+}
+
+void TestResultCache::replay(TestResultCollector* collector)
+{
+	for(Skipped::const_iterator it = m_skipped.begin(); it != m_skipped.end(); ++it)
+		collector->addCachedTest(it->first, it->second);
+	m_skipped.clear();
+	m_skippedTests.clear();
+}
+
+void TestResultCache::startTest(Test* test)
+{
+	m_key = keyOf(test);
+	m_hasFailed = false;
+	m_startTime = Clock::microseconds();
+}
+
+void TestResultCache::addFailure(const TestFailure&)
+{
+	m_hasFailed = true;
+}
+
+void TestResultCache::endTest(Test* test)
+{
+	if(m_hasFailed || m_key.empty())
+		return;
+
+	Entry entry;
+	entry.duration = Clock::microseconds() - m_startTime;
+	entry.name = test->getScopedName();
+	std::ofstream stream(m_fileName.c_str(), std::ios::out | std::ios::app | std::ios::binary);
+	stream << m_key << '\t' << entry.duration << '\t' << m_binaryId << '\t' << entry.name << '\n';
+	m_entries[m_key] = entry;
+	m_key.clear();
+}
+
+void TestResultCache::endTestRun(Test*, TestResult*)
+{
+	if(m_collector)
+		replay(m_collector);
+
+	// Keeps the results appended by concurrent runs of the same build.
+	read();
+	write();
+}
+
+std::string TestResultCache::binaryId(const std::string& fileName)
+{
+#if !defined(CPPUNIT_NO_TESTPLUGIN)
+	std::string buildId = TestManifest::readBuildId(fileName);
+	if(! buildId.empty())
+		return buildId;
+#endif
+
+	std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+	if(! stream)
+		return "";
+	unsigned long long value = hashBasis;
+	char buffer[64 * 1024];
+	while(stream.read(buffer, sizeof(buffer)) || stream.gcount() > 0)
+		hash(value, buffer, stream.gcount());
+	return toHex(value);
+}
+
+void TestResultCache::read()
+{
+	// Each line is a key, the duration in microseconds, the identifier of the
+	// build and the scoped name. Only the results of this build can match.
+	std::ifstream stream(m_fileName.c_str(), std::ios::in | std::ios::binary);
+	std::string line;
+	while(std::getline(stream, line))
+	{
+		std::istringstream fields(line);
+		std::string key, duration, binaryId, name;
+		std::getline(fields, key, '\t');
+		std::getline(fields, duration, '\t');
+		std::getline(fields, binaryId, '\t');
+		std::getline(fields, name);
+		if(key.empty() || binaryId != m_binaryId)
+			continue;
+		Entry& entry = m_entries[key];
+		entry.duration = ::strtoull(duration.c_str(), NULL, 10);
+		entry.name = name;
+	}
+}
+
+void TestResultCache::write() const
+{
+	std::ofstream stream(m_fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+	for(Entries::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+		stream << it->first << '\t' << it->second.duration << '\t' << m_binaryId << '\t' << it->second.name << '\n';
+}
+
+std::string TestResultCache::keyOf(Test* test) const
+{
+	unsigned long long value = hashBasis;
+	hash(value, m_binaryId);
+	hash(value, test->getScopedName());
+
+	// The input files are declared by the fixture suite of the test case.
+	std::string name = test->getName();
+	std::string::size_type separator = name.rfind("::");
+	if(separator == std::string::npos)
+		return toHex(value);
+
+	const CppUnitVector<std::string>& inputFiles = inputFilesOf(name.substr(0, separator));
+	for(CppUnitVector<std::string>::const_iterator file = inputFiles.begin(); file != inputFiles.end(); ++file)
+	{
+		hash(value, *file);
+		hash(value, hashFile(*file));
+	}
+	return toHex(value);
+}
+
+const CppUnitVector<std::string>& TestResultCache::inputFilesOf(const std::string& suiteName) const
+{
+	InputFiles::const_iterator it = m_inputFiles.find(suiteName);
+	if(it != m_inputFiles.end())
+		return it->second;
+
+	CppUnitVector<std::string>& inputFiles = m_inputFiles[suiteName];
+	std::string fileNames = m_tests ? findProperty(m_tests, suiteName, "InputFiles") : std::string();
+	std::string::size_type start = 0;
+	while(start <= fileNames.length())
+	{
+		std::string::size_type end = fileNames.find(';', start);
+		if(end == std::string::npos)
+			end = fileNames.length();
+		if(end > start)
+		{
+			std::string fileName = fileNames.substr(start, end - start);
+			inputFiles.push_back(isAbsolute(fileName) ? fileName : m_workingDirectory + "/" + fileName);
+		}
+		start = end + 1;
+	}
+	return inputFiles;
+}
+
+std::string TestResultCache::hashFile(const std::string& fileName) const
+{
+	Hashes::const_iterator it = m_fileHashes.find(fileName);
+	if(it != m_fileHashes.end())
+		return it->second;
+
+	std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+	std::string fileHash = "missing";
+	if(stream)
+	{
+		unsigned long long value = hashBasis;
+		char buffer[64 * 1024];
+		while(stream.read(buffer, sizeof(buffer)) || stream.gcount() > 0)
+			hash(value, buffer, stream.gcount());
+		fileHash = toHex(value);
+	}
+	m_fileHashes[fileName] = fileHash;
+	return fileHash;
+}
+
+
+CPPUNIT_NS_END
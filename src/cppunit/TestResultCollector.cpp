@@ -1,5 +1,7 @@
 #include <cppunit/TestFailure.h>
 #include <cppunit/TestResultCollector.h>
+#include <cppunit/tools/Clock.h>
+#include <cppunit/tools/ResourceUsage.h>
 
 
 CPPUNIT_NS_BEGIN
@@ -10,6 +12,17 @@ TestResultCollector::TestResultCollector( SynchronizationObject *syncObject )
     , m_tests()
     , m_failures()
     , m_testErrors(0)
+    , m_testStatuses()
+    , m_testDurations()
+    , m_testFailureIndexes()
+    , m_testCpuTimes()
+    , m_testPeakMemories()
+    , m_testCachedFlags()
+    , m_cachedTests( 0 )
+    , m_currentTest( -1 )
+    , m_startTime( 0 )
+    , m_startCpuTime( 0 )
+    , m_collectResourceUsage( false )
 {
   reset();
 }
@@ -26,7 +39,7 @@ TestResultCollector::freeFailures()
 {
   TestFailures::iterator itFailure = m_failures.begin();
   while ( itFailure != m_failures.end() )
-    delete *itFailure++;
+    (*itFailure++)->release();
   m_failures.clear();
 }
 
@@ -40,14 +53,80 @@ TestResultCollector::reset()
   freeFailures();
   m_testErrors = 0;
   m_tests.clear();
+  m_testStatuses.clear();
+  m_testDurations.clear();
+  m_testFailureIndexes.clear();
+  m_testCpuTimes.clear();
+  m_testPeakMemories.clear();
+  m_testCachedFlags.clear();
+  m_cachedTests = 0;
+  m_currentTest = -1;
+}
+
+
+void 
+TestResultCollector::setCollectResourceUsage( bool collect )
+{
+  ExclusiveZone zone( m_syncObject ); 
+  m_collectResourceUsage = collect;
 }
 
 
 void 
 TestResultCollector::startTest( Test *test )
+{
+  ExclusiveZone zone (m_syncObject); 
+  m_currentTest = m_tests.size();
+  m_tests.push_back( test );
+  m_testStatuses.push_back( TestRecord::running );
+  m_testDurations.push_back( 0 );
+  m_testFailureIndexes.push_back( -1 );
+  m_testCpuTimes.push_back( 0 );
+  m_testPeakMemories.push_back( 0 );
+  m_testCachedFlags.push_back( false );
+
+  if ( m_collectResourceUsage )
+    m_startCpuTime = ResourceUsage::current().cpuTime;
+  m_startTime = Clock::microseconds();
+}
+
+
+void 
+TestResultCollector::endTest( Test *test )
+{
+  unsigned long long endTime = Clock::microseconds();
+
+  ExclusiveZone zone (m_syncObject); 
+  if ( m_currentTest < 0  ||  m_tests[ m_currentTest ] != test )
+    return;
+
+  m_testDurations[ m_currentTest ] = endTime - m_startTime;
+  if ( m_testStatuses[ m_currentTest ] == TestRecord::running )
+    m_testStatuses[ m_currentTest ] = TestRecord::success;
+
+  if ( m_collectResourceUsage )
+  {
+    ResourceUsage usage = ResourceUsage::current();
+    m_testCpuTimes[ m_currentTest ] = usage.cpuTime - m_startCpuTime;
+    m_testPeakMemories[ m_currentTest ] = usage.peakMemory;
+  }
+  m_currentTest = -1;
+}
+
+
+void 
+TestResultCollector::addCachedTest( Test *test, 
+                                    unsigned long long duration )
 {
   ExclusiveZone zone (m_syncObject); 
   m_tests.push_back( test );
+  m_testStatuses.push_back( TestRecord::success );
+  m_testDurations.push_back( duration );
+  m_testFailureIndexes.push_back( -1 );
+  m_testCpuTimes.push_back( 0 );
+  m_testPeakMemories.push_back( 0 );
+  m_testCachedFlags.push_back( true );
+  ++m_cachedTests;
 }
 
 
@@ -59,7 +138,17 @@ TestResultCollector::addFailure( const TestFailure &failure )
   ExclusiveZone zone( m_syncObject ); 
   if ( failure.isError() )
     ++m_testErrors;
-  m_failures.push_back( failure.clone() );
+
+  // Only the first failure of a test is indexed, as in TestRecord.
+  if ( m_currentTest >= 0  &&  
+       m_tests[ m_currentTest ] == failure.failedTest()  &&
+       m_testFailureIndexes[ m_currentTest ] < 0 )
+  {
+    m_testFailureIndexes[ m_currentTest ] = m_failures.size();
+    m_testStatuses[ m_currentTest ] = failure.isError() ? TestRecord::error 
+                                                        : TestRecord::failure;
+  }
+  m_failures.push_back( failure.share() );
 }
 
 
@@ -99,6 +188,14 @@ TestResultCollector::testFailuresTotal() const
 }
 
 
+int 
+TestResultCollector::cachedTests() const
+{
+  ExclusiveZone zone( m_syncObject ); 
+  return m_cachedTests;
+}
+
+
 /// Returns a the list failures (random access collection).
 const TestResultCollector::TestFailures & 
 TestResultCollector::failures() const
@@ -116,5 +213,46 @@ TestResultCollector::tests() const
 }
 
 
-CPPUNIT_NS_END
+const TestResultCollector::TestStatuses &
+TestResultCollector::testStatuses() const
+{
+  return m_testStatuses;
+}
+
+
+const TestResultCollector::Counters &
+TestResultCollector::testDurations() const
+{
+  return m_testDurations;
+}
+
+
+const TestResultCollector::FailureIndexes &
+TestResultCollector::testFailureIndexes() const
+{
+  return m_testFailureIndexes;
+}
+
 
+const TestResultCollector::Counters &
+TestResultCollector::testCpuTimes() const
+{
+  return m_testCpuTimes;
+}
+
+
+const TestResultCollector::Counters &
+TestResultCollector::testPeakMemories() const
+{
+  return m_testPeakMemories;
+}
+
+
+const TestResultCollector::Flags &
+TestResultCollector::testCachedFlags() const
+{
+  return m_testCachedFlags;
+}
+
+
+CPPUNIT_NS_END
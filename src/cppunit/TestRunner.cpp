@@ -2,6 +2,7 @@
 #include <cppunit/TestRunner.h>
 #include <cppunit/TestPath.h>
 #include <cppunit/TestResult.h>
+#include "TestNameIndex.h"
 
 
 CPPUNIT_NS_BEGIN
@@ -9,10 +10,25 @@ CPPUNIT_NS_BEGIN
 
 TestRunner::WrappingSuite::WrappingSuite( const std::string &name ) 
     : TestSuite( name )
+    , m_index( new TestNameIndex() )
 {
 }
 
 
+TestRunner::WrappingSuite::~WrappingSuite()
+{
+  delete m_index;
+}
+
+
+void 
+TestRunner::WrappingSuite::addTest( Test *test )
+{
+  TestSuite::addTest( test );
+  m_index->invalidate();
+}
+
+
 int 
 TestRunner::WrappingSuite::getChildTestCount() const
 {
@@ -50,6 +66,15 @@ TestRunner::WrappingSuite::run( TestResult *result )
 }
 
 
+bool 
+TestRunner::WrappingSuite::findTestPath( const std::string &testName, 
+                                         TestPath &testPath ) const
+{
+  Test *mutableThis = CPPUNIT_CONST_CAST( Test *, this );
+  return m_index->find( mutableThis, testName, testPath );
+}
+
+
 bool 
 TestRunner::WrappingSuite::hasOnlyOneTest() const
 {
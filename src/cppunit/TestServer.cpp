@@ -0,0 +1,194 @@
+#include <cppunit/TestServer.h>
+#include <cppunit/Exception.h>
+#include <cppunit/Test.h>
+#include <cppunit/TestFailure.h>
+#include <cppunit/TestNameFilter.h>
+#include <cppunit/TestPath.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/tools/Clock.h>
+#include <cppunit/tools/LocalSocket.h>
+#include <sstream>
+#include <stdexcept>
+#include <stdio.h>
+#include <vector>
+
+
+CPPUNIT_NS_BEGIN
+
+
+namespace
+{
+	const char* statusNames[] =
+	{
+		"running",
+		"success",
+		"failure",
+		"error"
+	};
+}
+
+
+TestServer::TestServer(Test* root, TestResult* controller, TestResultCollector* result, const std::string& socketPath)
+	: m_root(root)
+	, m_controller(controller)
+	, m_result(result)
+	, m_socket(new LocalSocket(socketPath))
+	, m_record()
+	, m_startTime(0)
+{
+}
+
+TestServer::~TestServer()
+{
+	delete m_socket;
+}
+
+void TestServer::serve()
+{
+	while(m_socket->accept())
+	{
+		std::string request;
+		while(m_socket->readLine(request))
+		{
+			if(! runRequest(request))
+				return;
+		}
+	}
+}
+
+bool TestServer::runRequest(const std::string& request)
+{
+	std::vector<std::string> testPaths;
+	TestNameFilter filter;
+	bool hasFilter = false;
+
+	std::vector<Test*> tests;
+	try
+	{
+		std::istringstream words(request);
+		std::string word;
+		while(words >> word)
+		{
+			if(word == "--shutdown")
+				return false;
+			if(word == "-f" || word == "--filter")
+			{
+				if(! (words >> word))
+					throw std::invalid_argument("missing value for option -f");
+				filter.addPatterns(word);
+				hasFilter = true;
+			}
+			else if(word.compare(0, 1, "-") == 0)
+			{
+				throw std::invalid_argument("invalid option " + word);
+			}
+			else
+			{
+				testPaths.push_back(word);
+			}
+		}
+
+		for(std::vector<std::string>::const_iterator it = testPaths.begin(); it != testPaths.end(); ++it)
+			tests.push_back(m_root->resolveTestPath(*it).getChildTest());
+		if(tests.empty())
+			tests.push_back(m_root);
+	}
+	catch(std::exception& e)
+	{
+		std::string line = "error";
+		appendField(line, e.what());
+		send(line);
+		return true;
+	}
+
+	m_controller->reset();
+	m_result->reset();
+	if(hasFilter)
+		m_controller->addFilter(&filter);
+	m_controller->addListener(this);
+
+	for(std::vector<Test*>::const_iterator it = tests.begin(); it != tests.end() && ! m_controller->shouldStop(); ++it)
+		m_controller->runTest(*it);
+
+	m_controller->removeListener(this);
+	if(hasFilter)
+		m_controller->removeFilter(&filter);
+
+	char counts[64];
+	::sprintf(counts, "result\t%d\t%d\t%d", m_result->runTests(), m_result->testFailures(), m_result->testErrors());
+	send(counts);
+	return true;
+}
+
+void TestServer::startTest(Test* test)
+{
+	m_record = TestRecord();
+	m_record.name = test->getScopedName();
+	m_startTime = Clock::microseconds();
+
+	std::string line = "start";
+	appendField(line, m_record.name);
+	send(line);
+}
+
+void TestServer::addFailure(const TestFailure& failure)
+{
+	m_record.setFailure(failure);
+
+	std::string message = failure.thrownException()->message().shortDescription();
+	for(int index = 0; index < failure.thrownException()->message().detailCount(); ++index)
+		message += "\n" + failure.thrownException()->message().detailAt(index);
+
+	char lineNumber[32];
+	::sprintf(lineNumber, "%d", failure.sourceLine().lineNumber());
+
+	std::string line = "failure";
+	appendField(line, failure.failedTest()->getScopedName());
+	appendField(line, failure.isError() ? "error" : "assertion");
+	appendField(line, failure.sourceLine().fileName());
+	appendField(line, lineNumber);
+	appendField(line, message);
+	send(line);
+}
+
+void TestServer::endTest(Test*)
+{
+	if(m_record.status == TestRecord::running)
+		m_record.status = TestRecord::success;
+
+	char duration[32];
+	::sprintf(duration, "%llu", Clock::microseconds() - m_startTime);
+
+	std::string line = "end";
+	appendField(line, m_record.name);
+	appendField(line, statusNames[m_record.status]);
+	appendField(line, duration);
+	send(line);
+}
+
+void TestServer::send(const std::string& line)
+{
+	// A client that went away does not want the rest of the run.
+	if(! m_socket->write(line + "\n"))
+		m_controller->stop();
+}
+
+void TestServer::appendField(std::string& line, const std::string& field)
+{
+	line += '\t';
+	for(std::string::const_iterator it = field.begin(); it != field.end(); ++it)
+	{
+		if(*it == '\t')
+			line += "\\t";
+		else if(*it == '\n')
+			line += "\\n";
+		else if(*it == '\\')
+			line += "\\\\";
+		else
+			line += *it;
+	}
+}
+
+
+CPPUNIT_NS_END
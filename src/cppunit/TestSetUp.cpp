@@ -1,4 +1,5 @@
 #include <cppunit/extensions/TestSetUp.h>
+#include <cppunit/TestResult.h>
 
 CPPUNIT_NS_BEGIN
 
@@ -23,6 +24,9 @@ TestSetUp::tearDown()
 void
 TestSetUp::run( TestResult *result )
 { 
+  if ( !result->shouldRun( this ) )
+    return;
+
   setUp();
   TestDecorator::run(result);
   tearDown();
@@ -9,6 +9,7 @@ CPPUNIT_NS_BEGIN
 TestSuite::TestSuite( std::string name )
     : TestComposite( name )
     , m_tests()
+    , m_properties()
 {
 }
 
@@ -47,6 +48,37 @@ TestSuite::getTests() const
 }
 
 
+void 
+TestSuite::addProperty( const std::string &key, 
+                        const std::string &value )
+{
+  Properties::iterator it = m_properties.begin();
+  for ( ; it != m_properties.end(); ++it )
+  {
+    if ( (*it).first == key )
+    {
+      (*it).second = value;
+      return;
+    }
+  }
+
+  m_properties.push_back( Property( key, value ) );
+}
+
+
+std::string 
+TestSuite::getProperty( const std::string &key ) const
+{
+  Properties::const_iterator it = m_properties.begin();
+  for ( ; it != m_properties.end(); ++it )
+  {
+    if ( (*it).first == key )
+      return (*it).second;
+  }
+  return "";
+}
+
+
 int 
 TestSuite::getChildTestCount() const
 {
@@ -56,6 +56,8 @@ void
 TestSuiteBuilderContextBase::addProperty( const std::string &key, 
                                           const std::string &value )
 {
+  m_suite.addProperty( key, value );
+
   Properties::iterator it = m_properties.begin();
   for ( ; it != m_properties.end(); ++it )
   {
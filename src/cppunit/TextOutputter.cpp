@@ -58,6 +58,7 @@ TextOutputter::printFailure( TestFailure *failure,
   m_stream << "\n";
   printFailureDetail( failure->thrownException() );
   m_stream << "\n";
+  printCapturedOutput( failure );
 }
 
 
@@ -103,11 +104,29 @@ TextOutputter::printFailureDetail( Exception *thrownException )
 }
 
 
+void 
+TextOutputter::printCapturedOutput( TestFailure *failure )
+{
+  std::string output = failure->capturedOutput();
+  if ( output.empty() )
+    return;
+
+  m_stream  <<  "Captured output:\n"  <<  output;
+  if ( output[ output.length() - 1 ] != '\n' )
+    m_stream  <<  "\n";
+}
+
+
 void 
 TextOutputter::printHeader()
 {
   if ( m_result->wasSuccessful() )
-    m_stream << "\nOK (" << m_result->runTests () << " tests)\n" ;
+  {
+    m_stream << "\nOK (" << m_result->runTests () << " tests";
+    if ( m_result->cachedTests() > 0 )
+      m_stream << ", " << m_result->cachedTests() << " cached";
+    m_stream << ")\n" ;
+  }
   else
   {
     m_stream << "\n";
@@ -39,7 +39,7 @@ void TextTestProgressListener::endTest(Test* test)
 			writeError();
 		else
 			writeFailure();
-		delete _failure;
+		_failure->release();
 		_failure = NULL;
 	}
 	else
@@ -54,7 +54,9 @@ void TextTestProgressListener::endTest(Test* test)
 
 void TextTestProgressListener::addFailure(const TestFailure& failure)
 {
-	_failure = failure.clone();
+	if(_failure != NULL)
+		_failure->release();
+	_failure = failure.share();
 }
 
 void TextTestProgressListener::startTestRun(Test* test, TestResult*)
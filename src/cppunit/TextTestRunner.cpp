@@ -1,15 +1,37 @@
 // ==> Implementation of cppunit/ui/text/TestRunner.h
 
 #include <cppunit/config/SourcePrefix.h>
+#include <cppunit/BinaryResultListener.h>
+#include <cppunit/CoverageListener.h>
+#include <cppunit/HistoryListener.h>
+#include <cppunit/JournalListener.h>
+#include <cppunit/ResultComparison.h>
+#include <cppunit/TestChangeFilter.h>
+#include <cppunit/TestListWriter.h>
+#include <cppunit/TestNameFilter.h>
+#include <cppunit/TestOrder.h>
+#include <cppunit/TestPath.h>
+#include <cppunit/TestResultCache.h>
 #include <cppunit/TestSuite.h>
 #include <cppunit/TextTestResult.h>
 #include <cppunit/TextOutputter.h>
 #include <cppunit/TextTestProgressListener.h>
 #include <cppunit/TestResult.h>
+#include <cppunit/TestServer.h>
 #include <cppunit/XmlOutputter.h>
 #include <cppunit/ui/text/TextTestRunner.h>
+#include <cppunit/portability/CppUnitVector.h>
 #include <cppunit/portability/Stream.h>
+#include <cppunit/tools/OutputCapture.h>
+#include <iostream>
 #include <stdexcept>
+#include <stdio.h>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 #include "Options.h"
 
@@ -17,6 +39,113 @@
 CPPUNIT_NS_BEGIN
 
 
+namespace
+{
+	/// Listeners and filters owned by TextTestRunner::run(), attached to its
+	/// event manager. Detached, then destroyed in reverse order of creation.
+	class Attachments
+	{
+	public:
+		Attachments(TestResult* eventManager)
+			: m_eventManager(eventManager)
+			, m_listeners()
+			, m_filters()
+			, m_objects()
+		{
+		}
+
+		~Attachments()
+		{
+			clear();
+		}
+
+		/// Takes the ownership of an object.
+		template<typename Object>
+		Object* own(Object* object)
+		{
+			Owned owned;
+			owned.object = object;
+			owned.destroy = &destroy<Object>;
+			m_objects.push_back(owned);
+			return object;
+		}
+
+		void addListener(TestListener* listener)
+		{
+			m_eventManager->addListener(listener);
+			m_listeners.push_back(listener);
+		}
+
+		void addFilter(TestFilter* filter)
+		{
+			m_eventManager->addFilter(filter);
+			m_filters.push_back(filter);
+		}
+
+		/// Removes the listeners and filters from the event manager.
+		void detach()
+		{
+			while(! m_filters.empty())
+			{
+				m_eventManager->removeFilter(m_filters.back());
+				m_filters.pop_back();
+			}
+			while(! m_listeners.empty())
+			{
+				m_eventManager->removeListener(m_listeners.back());
+				m_listeners.pop_back();
+			}
+		}
+
+		/// Detaches and destroys the owned objects.
+		void clear()
+		{
+			detach();
+			while(! m_objects.empty())
+			{
+				Owned owned = m_objects.back();
+				m_objects.pop_back();
+				owned.destroy(owned.object);
+			}
+		}
+
+	private:
+		struct Owned
+		{
+			void* object;
+			void (*destroy)(void* object);
+		};
+
+		template<typename Object>
+		static void destroy(void* object)
+		{
+			delete static_cast<Object*>(object);
+		}
+
+		TestResult*                   m_eventManager;
+		CppUnitVector<TestListener*>  m_listeners;
+		CppUnitVector<TestFilter*>    m_filters;
+		CppUnitVector<Owned>          m_objects;
+	};
+
+	/// Writes the file of a listener, reporting a failure on stderr.
+	template<typename Listener>
+	bool writeFile(Listener& listener, const char* program)
+	{
+		try
+		{
+			listener.write();
+			return true;
+		}
+		catch(std::exception& e)
+		{
+			stdCErr() << program << ": " << e.what() << std::endl;
+			return false;
+		}
+	}
+}
+
+
 /*! Constructs a new text runner.
  * \param outputter used to print text result. Owned by the runner.
  */
@@ -24,6 +153,7 @@ TextTestRunner::TextTestRunner(Outputter* outputter)
     : m_result(new TestResultCollector())
     , m_eventManager(new TestResult())
     , m_outputter(outputter)
+    , m_order(NULL)
 {
 	if(! m_outputter)
 		m_outputter = new TextOutputter(m_result, stdCOut());
@@ -44,7 +174,8 @@ TextTestRunner::~TextTestRunner()
  * \param argv Argument values, as given by main(). Run program with --help
  *             for a comprehensive list of program options.
  * \return \c true if the tests were successful, \c false if the tests
- *         failed or were not found.
+ *         failed or were not found. With --fast-exit, does not return: the
+ *         process exits with 0 if the tests were successful, 1 otherwise.
  */
 bool TextTestRunner::run(int argc, const char* argv[])
 {
@@ -54,7 +185,159 @@ bool TextTestRunner::run(int argc, const char* argv[])
 	if(opts.doXmlOutput())
 		setOutputter(new XmlOutputter(m_result, stdCOut()));
 
-	return run(opts.testNames(), opts.doWait(), opts.doPrintResult(), opts.doPrintProgress(), opts.doPrintVerbose());
+	Attachments attachments(m_eventManager);
+	TestNameFilter* filter = NULL;
+	TestChangeFilter* changeFilter = NULL;
+	try
+	{
+		if(! opts.testFilters().empty())
+		{
+			filter = attachments.own(new TestNameFilter());
+			for(std::vector<std::string>::const_iterator it = opts.testFilters().begin(); it != opts.testFilters().end(); ++it)
+				filter->addPatterns(*it);
+		}
+		if(! opts.changedIndexFile().empty())
+		{
+			// Without an index yet, all the tests are selected.
+			CoverageIndex index;
+			index.read(opts.changedIndexFile());
+			changeFilter = attachments.own(new TestChangeFilter(index));
+			changeFilter->addDiff(std::cin);
+		}
+	}
+	catch(std::exception& e)
+	{
+		stdCErr() << argv[0] << ": " << e.what() << std::endl;
+		return false;
+	}
+
+	if(filter)
+		attachments.addFilter(filter);
+	if(changeFilter)
+		attachments.addFilter(changeFilter);
+
+	if(opts.doListTests())
+	{
+		listTests(opts.doListJson());
+		return true;
+	}
+
+	if(! opts.serveSocket().empty())
+		return serve(opts.serveSocket());
+
+	OutputCapture* capture = NULL;
+	JournalListener* journal = NULL;
+	BinaryResultListener* binaryOutput = NULL;
+	HistoryListener* history = NULL;
+	ResultComparison* comparison = NULL;
+	CoverageListener* coverage = NULL;
+	TestResultCache* cache = NULL;
+	TestOrder* order = NULL;
+#if defined(__linux__)
+	std::string executable = "/proc/self/exe";
+#else
+	std::string executable = argv[0];
+#endif
+	try
+	{
+		if(opts.doCaptureOutput())
+			capture = attachments.own(new OutputCapture(opts.captureLimit()));
+		if(! opts.journalFile().empty())
+			journal = attachments.own(new JournalListener(opts.journalFile(), opts.doResume()));
+		if(! opts.binaryOutputFile().empty())
+			binaryOutput = attachments.own(new BinaryResultListener(opts.binaryOutputFile()));
+		if(! opts.historyDirectory().empty())
+			history = attachments.own(new HistoryListener(opts.historyDirectory()));
+		if(! opts.compareWithFile().empty())
+		{
+			if(opts.doFailOnSlowdown() && ! ResultFile::hasDurations(opts.compareWithFile()))
+				throw std::runtime_error("--fail-on-slowdown needs a binary result file, <" + opts.compareWithFile() + "> has no durations");
+			ResultFile::Records previous;
+			ResultFile::load(opts.compareWithFile(), previous);
+			comparison = attachments.own(new ResultComparison(previous, opts.slowdownThreshold()));
+		}
+		if(! opts.coverageFile().empty())
+			coverage = attachments.own(new CoverageListener(opts.coverageFile()));
+		else if(! opts.changedIndexFile().empty())
+			coverage = attachments.own(new CoverageListener(opts.changedIndexFile()));
+		if(! opts.cacheDirectory().empty())
+			cache = attachments.own(new TestResultCache(opts.cacheDirectory(), TestResultCache::binaryId(executable), m_suite, m_result));
+		if(! opts.testOrder().empty() || opts.timeBudget() > 0)
+		{
+			TestOrder::Mode mode = opts.testOrder() == "failed-first" ? TestOrder::failedFirst : TestOrder::likelyFail;
+			order = attachments.own(new TestOrder(opts.orderFile(), TestResultCache::binaryId(executable), mode));
+			order->setTimeBudget(opts.timeBudget() * 1000000ULL);
+		}
+	}
+	catch(std::exception& e)
+	{
+		stdCErr() << argv[0] << ": " << e.what() << std::endl;
+		return false;
+	}
+
+	m_eventManager->setOutputCapture(capture);
+	if(journal)
+	{
+		attachments.addListener(journal);
+		if(opts.doResume())
+		{
+			attachments.addFilter(journal);
+			journal->replay(m_suite, m_result);
+		}
+	}
+	if(binaryOutput)
+		attachments.addListener(binaryOutput);
+	if(history)
+		attachments.addListener(history);
+	if(comparison)
+		attachments.addListener(comparison);
+	if(coverage)
+		attachments.addListener(coverage);
+	if(cache)
+	{
+		attachments.addListener(cache);
+		attachments.addFilter(cache);
+	}
+	if(order)
+	{
+		attachments.addListener(order);
+		setTestOrder(order);
+	}
+	m_eventManager->stopOnFailure(opts.doFailFast());
+
+	bool wasSuccessful = run(opts.testNames(), opts.doWait(), opts.doPrintResult(), opts.doPrintProgress(), opts.doPrintVerbose());
+
+	m_eventManager->setOutputCapture(NULL);
+	if(order)
+		setTestOrder(NULL);
+	attachments.detach();
+
+	if(comparison)
+	{
+		comparison->write(stdCOut());
+		if(opts.doFailOnSlowdown() && comparison->hasSlowdowns())
+			wasSuccessful = false;
+	}
+	// The index of --changed is maintained by the instrumented runs only.
+	if(coverage && (! opts.coverageFile().empty() || CoverageListener::isInstrumented()))
+		wasSuccessful = writeFile(*coverage, argv[0]) && wasSuccessful;
+	if(order)
+	{
+		order->writeDeferred(stdCOut());
+		wasSuccessful = writeFile(*order, argv[0]) && wasSuccessful;
+	}
+	attachments.clear();
+
+	if(opts.doFastExit())
+	{
+		// Skips the destruction of the tests and of the results.
+		stdCOut().flush();
+		stdCErr().flush();
+		::fflush(NULL);
+		::_exit(wasSuccessful ? 0 : 1);
+	}
+
+	return wasSuccessful;
 }
 
 /*! Runs the named test case.
@@ -108,6 +391,48 @@ bool TextTestRunner::run(const std::vector<std::string>& testNames, bool doWait,
 }
 
 
+/*! Lists the tests without running them.
+ *
+ * Only the tests selected by the filters of the event manager are listed.
+ * \param doJson if \c true the list is printed as JSON, otherwise as indented
+ *               text.
+ * \see TestListWriter.
+ */
+void TextTestRunner::listTests(bool doJson)
+{
+	TestListWriter writer(m_suite, m_eventManager);
+	if(doJson)
+		writer.writeJson(stdCOut());
+	else
+		writer.write(stdCOut());
+}
+
+
+/*! Runs the tests requested over a local socket, until a shutdown request.
+ *
+ * The filters of the event manager apply to every request. The result is
+ * reset once served: the results were sent to the clients.
+ * \param socketPath Path of the local socket.
+ * \return \c false if the socket could not be created.
+ * \see TestServer.
+ */
+bool TextTestRunner::serve(const std::string& socketPath)
+{
+	try
+	{
+		TestServer server(m_suite, m_eventManager, m_result, socketPath);
+		server.serve();
+		m_result->reset();
+	}
+	catch(std::exception& e)
+	{
+		stdCErr() << e.what() << std::endl;
+		return false;
+	}
+	return true;
+}
+
+
 void TextTestRunner::wait(bool doWait)
 {
 #if !defined(CPPUNIT_NO_STREAM)
@@ -163,9 +488,28 @@ void TextTestRunner::setOutputter(Outputter* outputter)
 }
 
 
+/*! Specifies the order of the test cases to run.
+ *
+ * \param order Order of the test cases, \c NULL to run them in the order they
+ *              were added (default). Not owned by the runner.
+ * \see TestOrder.
+ */
+void TextTestRunner::setTestOrder(TestOrder* order)
+{
+	m_order = order;
+}
+
+
 void TextTestRunner::run(TestResult& controller, const std::string &testPath)
 {
-	TestRunner::run(controller, testPath);
+	if(! m_order)
+	{
+		TestRunner::run(controller, testPath);
+		return;
+	}
+
+	TestPath path = m_suite->resolveTestPath(testPath);
+	controller.runTest(m_order->order(path.getChildTest(), &controller));
 }
 
 
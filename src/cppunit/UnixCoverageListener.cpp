@@ -0,0 +1,160 @@
+#include <cppunit/CoverageListener.h>
+
+#if defined(__ELF__)
+#include <link.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+#if defined(__ELF__)
+
+namespace
+{
+	struct Module
+	{
+		std::string fileName;
+		size_t      bias;
+		CppUnitVector<std::pair<size_t, size_t> > segments;
+	};
+
+	int addModule(struct dl_phdr_info* info, size_t, void* data)
+	{
+		CppUnitVector<Module>& modules = *(CppUnitVector<Module>*)data;
+		Module module;
+		module.fileName = info->dlpi_name ? info->dlpi_name : "";
+		if(module.fileName.empty())
+		{
+			// The main program is listed first, without a name.
+			char path[4096];
+			ssize_t length = ::readlink("/proc/self/exe", path, sizeof(path) - 1);
+			if(length <= 0)
+				return 0;
+			module.fileName.assign(path, length);
+		}
+		module.bias = info->dlpi_addr;
+		for(int index = 0; index < info->dlpi_phnum; ++index)
+		{
+			const ElfW(Phdr)& header = info->dlpi_phdr[index];
+			if(header.p_type == PT_LOAD && (header.p_flags & PF_X))
+				module.segments.push_back(std::make_pair(module.bias + header.p_vaddr, module.bias + header.p_vaddr + header.p_memsz));
+		}
+		modules.push_back(module);
+		return 0;
+	}
+
+	std::string quote(const std::string& text)
+	{
+		std::string quoted = "'";
+		for(std::string::const_iterator it = text.begin(); it != text.end(); ++it)
+		{
+			if(*it == '\'')
+				quoted += "'\\''";
+			else
+				quoted += *it;
+		}
+		return quoted + "'";
+	}
+
+	/// Maps offsets of a module to source lines with addr2line.
+	bool mapModuleLines(const std::string& fileName, const CppUnitVector<size_t>& offsets, CppUnitVector<SourceLine>& lines)
+	{
+		const char* directory = ::getenv("TMPDIR");
+		std::string input = std::string(directory && *directory ? directory : "/tmp") + "/cppunit-coverage-XXXXXX";
+		int fd = ::mkstemp(&input[0]);
+		if(fd < 0)
+			return false;
+		FILE* stream = ::fdopen(fd, "w");
+		if(! stream)
+		{
+			::close(fd);
+			::unlink(input.c_str());
+			return false;
+		}
+		for(CppUnitVector<size_t>::const_iterator it = offsets.begin(); it != offsets.end(); ++it)
+			::fprintf(stream, "0x%lx\n", (unsigned long)*it);
+		bool written = ::fclose(stream) == 0;
+
+		FILE* output = written ? ::popen(("addr2line -e " + quote(fileName) + " < " + quote(input)).c_str(), "r") : NULL;
+		if(! output)
+		{
+			::unlink(input.c_str());
+			return false;
+		}
+
+		// addr2line prints one file:line per address, ?? when it is unknown.
+		char buffer[4096];
+		size_t count = 0;
+		while(count < offsets.size() && ::fgets(buffer, sizeof(buffer), output))
+		{
+			std::string line(buffer);
+			std::string::size_type end = line.find(" (discriminator");
+			if(end == std::string::npos)
+				end = line.find_last_not_of("\r\n") + 1;
+			line.erase(end);
+
+			std::string::size_type separator = line.rfind(':');
+			int number = separator == std::string::npos ? 0 : ::atoi(line.c_str() + separator + 1);
+			if(number > 0 && line.compare(0, 2, "??") != 0)
+				lines.push_back(SourceLine(line.substr(0, separator), number));
+			else
+				lines.push_back(SourceLine());
+			++count;
+		}
+		bool mapped = ::pclose(output) == 0 && count == offsets.size();
+		::unlink(input.c_str());
+		return mapped;
+	}
+}
+
+bool CoverageListener::doMapLines(const Addresses& addresses, CppUnitVector<SourceLine>& lines)
+{
+	CppUnitVector<Module> modules;
+	::dl_iterate_phdr(addModule, &modules);
+
+	lines.assign(addresses.size(), SourceLine());
+	for(CppUnitVector<Module>::const_iterator module = modules.begin(); module != modules.end(); ++module)
+	{
+		CppUnitVector<size_t> indexes;
+		CppUnitVector<size_t> offsets;
+		for(size_t index = 0; index < addresses.size(); ++index)
+		{
+			for(size_t segment = 0; segment < module->segments.size(); ++segment)
+			{
+				if(addresses[index] > module->segments[segment].first && addresses[index] <= module->segments[segment].second)
+				{
+					// The address follows the call to the callback: the
+					// byte before it is still in the instrumented line.
+					indexes.push_back(index);
+					offsets.push_back(addresses[index] - 1 - module->bias);
+					break;
+				}
+			}
+		}
+		if(offsets.empty())
+			continue;
+
+		CppUnitVector<SourceLine> moduleLines;
+		if(! mapModuleLines(module->fileName, offsets, moduleLines))
+			return false;
+		for(size_t index = 0; index < indexes.size(); ++index)
+			lines[indexes[index]] = moduleLines[index];
+	}
+	return true;
+}
+
+#else
+
+bool CoverageListener::doMapLines(const Addresses&, CppUnitVector<SourceLine>&)
+{
+	return false;
+}
+
+#endif
+
+
+CPPUNIT_NS_END
@@ -13,7 +13,9 @@ CPPUNIT_NS_BEGIN
 DynamicLibraryManager::LibraryHandle 
 DynamicLibraryManager::doLoadLibrary( const std::string &libraryName )
 {
-  return ::dlopen( libraryName.c_str(), RTLD_NOW | RTLD_GLOBAL );
+  int mode = (m_flags & lazyBinding) ? RTLD_LAZY : RTLD_NOW;
+  mode |= (m_flags & localSymbols) ? RTLD_LOCAL : RTLD_GLOBAL;
+  return ::dlopen( libraryName.c_str(), mode );
 }
 
 
@@ -31,6 +33,16 @@ DynamicLibraryManager::doFindSymbol( const std::string &symbol )
 }
 
 
+const void *
+DynamicLibraryManager::doFindLibraryBase( const void *address )
+{
+  Dl_info info;
+  if ( ::dladdr( const_cast<void *>( address ), &info ) == 0 )
+    return NULL;
+  return info.dli_fbase;
+}
+
+
 std::string 
 DynamicLibraryManager::getLastErrorDetail() const
 {
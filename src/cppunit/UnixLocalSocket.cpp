@@ -0,0 +1,109 @@
+#include <cppunit/tools/LocalSocket.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+bool LocalSocket::doListen()
+{
+	sockaddr_un address;
+	::memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	if(m_path.empty() || m_path.length() >= sizeof(address.sun_path))
+		return false;
+	::memcpy(address.sun_path, m_path.data(), m_path.length());
+
+	m_listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if(m_listener < 0)
+		return false;
+	::fcntl(m_listener, F_SETFD, FD_CLOEXEC);
+
+	// Replaces the socket of a server that did not exit cleanly, never a regular file.
+	struct stat status;
+	if(::lstat(m_path.c_str(), &status) == 0 && S_ISSOCK(status.st_mode))
+		::unlink(m_path.c_str());
+
+	if(::bind(m_listener, (const sockaddr*)&address, sizeof(address)) != 0)
+	{
+		::close(m_listener);
+		m_listener = -1;
+		return false;
+	}
+	return ::listen(m_listener, 4) == 0;
+}
+
+void LocalSocket::doClose()
+{
+	if(m_listener < 0)
+		return;
+	::close(m_listener);
+	m_listener = -1;
+	::unlink(m_path.c_str());
+}
+
+bool LocalSocket::doAccept()
+{
+	do
+	{
+		m_connection = ::accept(m_listener, NULL, NULL);
+	}
+	while(m_connection < 0 && errno == EINTR);
+
+	if(m_connection < 0)
+		return false;
+	::fcntl(m_connection, F_SETFD, FD_CLOEXEC);
+#if defined(SO_NOSIGPIPE)
+	int enabled = 1;
+	::setsockopt(m_connection, SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+#endif
+	return true;
+}
+
+void LocalSocket::doDisconnect()
+{
+	if(m_connection >= 0)
+		::close(m_connection);
+	m_connection = -1;
+}
+
+long LocalSocket::doRead(char* buffer, size_t size)
+{
+	ssize_t count;
+	do
+	{
+		count = ::recv(m_connection, buffer, size, 0);
+	}
+	while(count < 0 && errno == EINTR);
+	return count;
+}
+
+bool LocalSocket::doWrite(const char* data, size_t size)
+{
+#if defined(MSG_NOSIGNAL)
+	const int flags = MSG_NOSIGNAL;
+#else
+	const int flags = 0;
+#endif
+	while(size > 0)
+	{
+		ssize_t count = ::send(m_connection, data, size, flags);
+		if(count < 0 && errno == EINTR)
+			continue;
+		if(count <= 0)
+			return false;
+		data += count;
+		size -= count;
+	}
+	return true;
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,68 @@
+#include <cppunit/tools/MappedFile.h>
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+bool MappedFile::doOpen()
+{
+	int fd = ::open(m_fileName.c_str(), m_writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+	if(fd < 0)
+		return false;
+
+	struct stat status;
+	if(::fstat(fd, &status) != 0)
+	{
+		::close(fd);
+		return false;
+	}
+
+	m_file = (void*)(intptr_t)fd;
+	m_size = status.st_size;
+	return true;
+}
+
+void MappedFile::doClose()
+{
+	::close((int)(intptr_t)m_file);
+}
+
+bool MappedFile::doMap()
+{
+	if(m_size == 0)
+		return true;
+
+	int protection = m_writable ? PROT_READ | PROT_WRITE : PROT_READ;
+	void* data = ::mmap(NULL, m_size, protection, MAP_SHARED, (int)(intptr_t)m_file, 0);
+	if(data == MAP_FAILED)
+		return false;
+
+	m_data = (char*)data;
+	return true;
+}
+
+void MappedFile::doUnmap()
+{
+	if(m_data != NULL)
+		::munmap(m_data, m_size);
+	m_data = NULL;
+}
+
+bool MappedFile::doResize(size_t size)
+{
+	return ::ftruncate((int)(intptr_t)m_file, size) == 0;
+}
+
+void MappedFile::doFlush()
+{
+	::msync(m_data, m_size, MS_ASYNC);
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,149 @@
+#include <cppunit/tools/OutputCapture.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief (INTERNAL) Pipe the output is redirected to, and the thread that drains it.
+ */
+struct OutputCapture::Pipe
+{
+	Pipe(OutputCapture* capture)
+		: capture(capture)
+		, thread()
+		, hasThread(false)
+		, stdoutCopy(-1)
+		, stderrCopy(-1)
+	{
+		output[0] = output[1] = -1;
+		wake[0] = wake[1] = -1;
+	}
+
+	~Pipe()
+	{
+		closeFile(stdoutCopy);
+		closeFile(stderrCopy);
+		closeFile(output[0]);
+		closeFile(output[1]);
+		closeFile(wake[0]);
+		closeFile(wake[1]);
+	}
+
+	static void closeFile(int file)
+	{
+		if(file >= 0)
+			::close(file);
+	}
+
+	static bool makePipe(int* files)
+	{
+		if(::pipe(files) != 0)
+			return false;
+		::fcntl(files[0], F_SETFD, FD_CLOEXEC);
+		::fcntl(files[1], F_SETFD, FD_CLOEXEC);
+		return true;
+	}
+
+	/// Reads the output until the end of the pipe, or until woken up by
+	/// doRestore(): what is left in the pipe is then read without waiting,
+	/// as a child process may still hold its write end.
+	static void* drain(void* self)
+	{
+		Pipe* pipe = static_cast<Pipe*>(self);
+		char buffer[64 * 1024];
+		bool isWoken = false;
+		while(true)
+		{
+			ssize_t bytes = ::read(pipe->output[0], buffer, sizeof(buffer));
+			if(bytes > 0)
+			{
+				pipe->capture->append(buffer, bytes);
+				continue;
+			}
+			if(bytes < 0 && errno == EINTR)
+				continue;
+			if(bytes == 0 || errno != EAGAIN || isWoken)
+				break;
+
+			struct pollfd files[2];
+			files[0].fd = pipe->output[0];
+			files[0].events = POLLIN;
+			files[0].revents = 0;
+			files[1].fd = pipe->wake[0];
+			files[1].events = POLLIN;
+			files[1].revents = 0;
+			if(::poll(files, 2, -1) < 0 && errno != EINTR)
+				break;
+			isWoken = (files[1].revents & POLLIN) != 0;
+		}
+		return NULL;
+	}
+
+	OutputCapture* capture;
+	pthread_t      thread;
+	bool           hasThread;
+	int            output[2];
+	int            wake[2];
+	int            stdoutCopy;
+	int            stderrCopy;
+};
+
+
+bool OutputCapture::doRedirect()
+{
+	m_pipe = new Pipe(this);
+	if(Pipe::makePipe(m_pipe->output) && Pipe::makePipe(m_pipe->wake)
+		&& ::fcntl(m_pipe->output[0], F_SETFL, O_NONBLOCK) == 0)
+	{
+		m_pipe->hasThread = ::pthread_create(&m_pipe->thread, NULL, &Pipe::drain, m_pipe) == 0;
+	}
+	if(m_pipe->hasThread)
+	{
+		m_pipe->stdoutCopy = ::dup(1);
+		m_pipe->stderrCopy = ::dup(2);
+		if(m_pipe->stdoutCopy >= 0 && m_pipe->stderrCopy >= 0
+			&& ::dup2(m_pipe->output[1], 1) >= 0 && ::dup2(m_pipe->output[1], 2) >= 0)
+		{
+			// Only the redirected descriptors hold the write end: the drain
+			// thread sees the end of the pipe once they are restored.
+			Pipe::closeFile(m_pipe->output[1]);
+			m_pipe->output[1] = -1;
+			return true;
+		}
+	}
+
+	doRestore();
+	return false;
+}
+
+void OutputCapture::doRestore()
+{
+	if(! m_pipe)
+		return;
+
+	if(m_pipe->stdoutCopy >= 0)
+		::dup2(m_pipe->stdoutCopy, 1);
+	if(m_pipe->stderrCopy >= 0)
+		::dup2(m_pipe->stderrCopy, 2);
+	Pipe::closeFile(m_pipe->output[1]);
+	m_pipe->output[1] = -1;
+
+	if(m_pipe->hasThread)
+	{
+		char byte = 0;
+		while(::write(m_pipe->wake[1], &byte, 1) < 0 && errno == EINTR)
+			;
+		::pthread_join(m_pipe->thread, NULL);
+	}
+	delete m_pipe;
+	m_pipe = NULL;
+}
+
+
+CPPUNIT_NS_END
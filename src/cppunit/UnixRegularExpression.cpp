@@ -0,0 +1,40 @@
+#include <cppunit/tools/RegularExpression.h>
+#include <stdexcept>
+#include <regex.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+RegularExpression::RegularExpression(const std::string& pattern)
+	: m_pattern(pattern)
+	, m_expression(new regex_t)
+{
+	int error = ::regcomp((regex_t*)m_expression, ("^(" + pattern + ")$").c_str(), REG_EXTENDED | REG_NOSUB);
+	if(error != 0)
+	{
+		char message[256];
+		::regerror(error, (regex_t*)m_expression, message, sizeof(message));
+		delete (regex_t*)m_expression;
+		throw std::runtime_error("RegularExpression: " + std::string(message) + " <" + pattern + ">");
+	}
+}
+
+RegularExpression::~RegularExpression()
+{
+	::regfree((regex_t*)m_expression);
+	delete (regex_t*)m_expression;
+}
+
+bool RegularExpression::matches(const std::string& text) const
+{
+	return ::regexec((const regex_t*)m_expression, text.c_str(), 0, NULL, 0) == 0;
+}
+
+const std::string& RegularExpression::pattern() const
+{
+	return m_pattern;
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,14 @@
+#include <cppunit/CoverageListener.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+bool CoverageListener::doMapLines(const Addresses&, CppUnitVector<SourceLine>&)
+{
+	// The sanitizer coverage instrumentation is not available with Visual C++.
+	return false;
+}
+
+
+CPPUNIT_NS_END
@@ -39,6 +39,19 @@ DynamicLibraryManager::doFindSymbol( const std::string &symbol )
 }
 
 
+const void *
+DynamicLibraryManager::doFindLibraryBase( const void *address )
+{
+  HMODULE module = NULL;
+  if ( !::GetModuleHandleExA( GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+                                  GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                              (LPCSTR)address,
+                              &module ) )
+    return NULL;
+  return module;
+}
+
+
 std::string 
 DynamicLibraryManager::getLastErrorDetail() const
 {
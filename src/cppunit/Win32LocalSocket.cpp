@@ -0,0 +1,39 @@
+#include <cppunit/tools/LocalSocket.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+// Local sockets are not supported on Windows: the constructor always fails.
+
+bool LocalSocket::doListen()
+{
+	return false;
+}
+
+void LocalSocket::doClose()
+{
+}
+
+bool LocalSocket::doAccept()
+{
+	return false;
+}
+
+void LocalSocket::doDisconnect()
+{
+	m_connection = -1;
+}
+
+long LocalSocket::doRead(char*, size_t)
+{
+	return -1;
+}
+
+bool LocalSocket::doWrite(const char*, size_t)
+{
+	return false;
+}
+
+
+CPPUNIT_NS_END
@@ -0,0 +1,89 @@
+#include <cppunit/tools/MappedFile.h>
+
+#define WIN32_LEAN_AND_MEAN 
+#define NOGDI
+#define NOUSER
+#define NOKERNEL
+#define NOSOUND
+#define NOMINMAX
+#include <windows.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+bool MappedFile::doOpen()
+{
+	HANDLE file = ::CreateFileA(m_fileName.c_str(),
+			m_writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+			FILE_SHARE_READ | FILE_SHARE_WRITE,
+			NULL,
+			m_writable ? OPEN_ALWAYS : OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL,
+			NULL);
+	if(file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if(! ::GetFileSizeEx(file, &size))
+	{
+		::CloseHandle(file);
+		return false;
+	}
+
+	m_file = file;
+	m_size = (size_t)size.QuadPart;
+	return true;
+}
+
+void MappedFile::doClose()
+{
+	::CloseHandle((HANDLE)m_file);
+}
+
+bool MappedFile::doMap()
+{
+	if(m_size == 0)
+		return true;
+
+	m_mapping = ::CreateFileMappingA((HANDLE)m_file, NULL,
+			m_writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, NULL);
+	if(m_mapping == NULL)
+		return false;
+
+	m_data = (char*)::MapViewOfFile((HANDLE)m_mapping,
+			m_writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, m_size);
+	if(m_data == NULL)
+	{
+		::CloseHandle((HANDLE)m_mapping);
+		m_mapping = NULL;
+		return false;
+	}
+	return true;
+}
+
+void MappedFile::doUnmap()
+{
+	if(m_data != NULL)
+		::UnmapViewOfFile(m_data);
+	if(m_mapping != NULL)
+		::CloseHandle((HANDLE)m_mapping);
+	m_data = NULL;
+	m_mapping = NULL;
+}
+
+bool MappedFile::doResize(size_t size)
+{
+	LARGE_INTEGER position;
+	position.QuadPart = (LONGLONG)size;
+	return ::SetFilePointerEx((HANDLE)m_file, position, NULL, FILE_BEGIN) &&
+		::SetEndOfFile((HANDLE)m_file);
+}
+
+void MappedFile::doFlush()
+{
+	::FlushViewOfFile(m_data, 0);
+}
+
+
+CPPUNIT_NS_END
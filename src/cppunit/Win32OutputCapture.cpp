@@ -0,0 +1,123 @@
+#include <cppunit/tools/OutputCapture.h>
+
+#include <fcntl.h>
+#include <io.h>
+#include <process.h>
+#include <stdio.h>
+#include <windows.h>
+
+
+CPPUNIT_NS_BEGIN
+
+
+/*! \brief (INTERNAL) Pipe the output is redirected to, and the thread that drains it.
+ */
+struct OutputCapture::Pipe
+{
+	Pipe(OutputCapture* capture)
+		: capture(capture)
+		, thread(NULL)
+		, isStopping(false)
+		, stdoutCopy(-1)
+		, stderrCopy(-1)
+	{
+		output[0] = output[1] = -1;
+	}
+
+	~Pipe()
+	{
+		if(thread)
+			::CloseHandle(thread);
+		closeFile(stdoutCopy);
+		closeFile(stderrCopy);
+		closeFile(output[0]);
+		closeFile(output[1]);
+	}
+
+	static void closeFile(int file)
+	{
+		if(file >= 0)
+			::_close(file);
+	}
+
+	/// Reads the output until the end of the pipe, or until doRestore()
+	/// cancels the read: what is left in the pipe is then read without
+	/// waiting, as a child process may still hold its write end.
+	static unsigned __stdcall drain(void* self)
+	{
+		Pipe* pipe = static_cast<Pipe*>(self);
+		HANDLE handle = (HANDLE)::_get_osfhandle(pipe->output[0]);
+		char buffer[64 * 1024];
+		while(true)
+		{
+			DWORD available = 0;
+			if(pipe->isStopping
+				&& (! ::PeekNamedPipe(handle, NULL, 0, NULL, &available, NULL) || available == 0))
+				break;
+
+			DWORD bytes = 0;
+			if(::ReadFile(handle, buffer, sizeof(buffer), &bytes, NULL) && bytes > 0)
+				pipe->capture->append(buffer, bytes);
+			else if(::GetLastError() != ERROR_OPERATION_ABORTED)
+				break;
+		}
+		return 0;
+	}
+
+	OutputCapture* capture;
+	HANDLE         thread;
+	volatile bool  isStopping;
+	int            output[2];
+	int            stdoutCopy;
+	int            stderrCopy;
+};
+
+
+bool OutputCapture::doRedirect()
+{
+	m_pipe = new Pipe(this);
+	if(::_pipe(m_pipe->output, 64 * 1024, _O_BINARY | _O_NOINHERIT) == 0)
+		m_pipe->thread = (HANDLE)::_beginthreadex(NULL, 0, &Pipe::drain, m_pipe, 0, NULL);
+	if(m_pipe->thread)
+	{
+		m_pipe->stdoutCopy = ::_dup(1);
+		m_pipe->stderrCopy = ::_dup(2);
+		if(m_pipe->stdoutCopy >= 0 && m_pipe->stderrCopy >= 0
+			&& ::_dup2(m_pipe->output[1], 1) == 0 && ::_dup2(m_pipe->output[1], 2) == 0)
+		{
+			// Only the redirected descriptors hold the write end: the drain
+			// thread sees the end of the pipe once they are restored.
+			Pipe::closeFile(m_pipe->output[1]);
+			m_pipe->output[1] = -1;
+			return true;
+		}
+	}
+
+	doRestore();
+	return false;
+}
+
+void OutputCapture::doRestore()
+{
+	if(! m_pipe)
+		return;
+
+	if(m_pipe->stdoutCopy >= 0)
+		::_dup2(m_pipe->stdoutCopy, 1);
+	if(m_pipe->stderrCopy >= 0)
+		::_dup2(m_pipe->stderrCopy, 2);
+	Pipe::closeFile(m_pipe->output[1]);
+	m_pipe->output[1] = -1;
+
+	if(m_pipe->thread)
+	{
+		m_pipe->isStopping = true;
+		while(::WaitForSingleObject(m_pipe->thread, 10) == WAIT_TIMEOUT)
+			::CancelSynchronousIo(m_pipe->thread);
+	}
+	delete m_pipe;
+	m_pipe = NULL;
+}
+
+
+CPPUNIT_NS_END
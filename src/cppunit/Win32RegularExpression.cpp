@@ -0,0 +1,39 @@
+#include <cppunit/tools/RegularExpression.h>
+#include <regex>
+#include <stdexcept>
+
+
+CPPUNIT_NS_BEGIN
+
+
+RegularExpression::RegularExpression(const std::string& pattern)
+	: m_pattern(pattern)
+	, m_expression(NULL)
+{
+	try
+	{
+		m_expression = new std::regex(pattern, std::regex::extended | std::regex::nosubs);
+	}
+	catch(std::regex_error& e)
+	{
+		throw std::runtime_error("RegularExpression: " + std::string(e.what()) + " <" + pattern + ">");
+	}
+}
+
+RegularExpression::~RegularExpression()
+{
+	delete (std::regex*)m_expression;
+}
+
+bool RegularExpression::matches(const std::string& text) const
+{
+	return std::regex_match(text, *(const std::regex*)m_expression);
+}
+
+const std::string& RegularExpression::pattern() const
+{
+	return m_pattern;
+}
+
+
+CPPUNIT_NS_END
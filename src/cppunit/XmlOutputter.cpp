@@ -79,7 +79,6 @@ XmlOutputter::setRootNode()
 
   FailedTests failedTests;
   fillFailedTestsMap( failedTests );
-
   addFailedTests( failedTests, rootNode );
   addSuccessfulTests( failedTests, rootNode );
   addStatistics( rootNode );
@@ -103,35 +102,39 @@ XmlOutputter::fillFailedTestsMap( FailedTests &failedTests )
 
 
 void
-XmlOutputter::addFailedTests( FailedTests &failedTests,
+XmlOutputter::addFailedTests( FailedTests &,
                               XmlElement *rootNode )
 {
   XmlElement *testsNode = new XmlElement( "FailedTests" );
   rootNode->addElement( testsNode );
 
   const TestResultCollector::Tests &tests = m_result->tests();
-  for ( unsigned int testNumber = 0; testNumber < tests.size(); ++testNumber )
+  const TestResultCollector::TestFailures &failures = m_result->failures();
+  const TestResultCollector::FailureIndexes &failureIndexes = 
+      m_result->testFailureIndexes();
+  for ( unsigned int testNumber = 0; testNumber < failureIndexes.size(); ++testNumber )
   {
-    Test *test = tests[testNumber];
-    if ( failedTests.find( test ) != failedTests.end() )
-      addFailedTest( test, failedTests[test], testNumber+1, testsNode );
+    int failureIndex = failureIndexes[testNumber];
+    if ( failureIndex >= 0 )
+      addFailedTest( tests[testNumber], failures[failureIndex], testNumber+1, testsNode );
   }
 }
 
 
 void
-XmlOutputter::addSuccessfulTests( FailedTests &failedTests,
+XmlOutputter::addSuccessfulTests( FailedTests &,
                                            XmlElement *rootNode )
 {
   XmlElement *testsNode = new XmlElement( "SuccessfulTests" );
   rootNode->addElement( testsNode );
 
   const TestResultCollector::Tests &tests = m_result->tests();
-  for ( unsigned int testNumber = 0; testNumber < tests.size(); ++testNumber )
+  const TestResultCollector::FailureIndexes &failureIndexes = 
+      m_result->testFailureIndexes();
+  for ( unsigned int testNumber = 0; testNumber < failureIndexes.size(); ++testNumber )
   {
-    Test *test = tests[testNumber];
-    if ( failedTests.find( test ) == failedTests.end() )
-      addSuccessfulTest( test, testNumber+1, testsNode );
+    if ( failureIndexes[testNumber] < 0 )
+      addSuccessfulTest( tests[testNumber], testNumber+1, testsNode );
   }
 }
 
@@ -171,7 +174,10 @@ XmlOutputter::addFailedTest( Test *test,
   if ( failure->sourceLine().isValid() )
     addFailureLocation( failure, testElement );
 
-  testElement->addElement( new XmlElement( "Message", thrownException->what() ) );
+  std::string message = thrownException->what();
+  if ( !failure->capturedOutput().empty() )
+    message += "\nCaptured output:\n" + failure->capturedOutput();
+  testElement->addElement( new XmlElement( "Message", message ) );
 
   for ( Hooks::iterator it = m_hooks.begin(); it != m_hooks.end(); ++it )
     (*it)->failTestAdded( m_xml, testElement, test, failure );
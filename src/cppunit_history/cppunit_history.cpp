@@ -0,0 +1,345 @@
+#include <cppunit/TestHistory.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+	/// Aggregates of a test over the scanned rows.
+	struct TestStats
+	{
+		TestStats()
+			: testId(0)
+			, count(0)
+			, sumX(0), sumY(0), sumXX(0), sumXY(0)
+			, lastRun(0)
+			, lastStatus(0)
+			, flips(0)
+			, failures(0)
+			, durations()
+			, next(0)
+		{}
+
+		unsigned long long testId;
+		unsigned int count;
+		double sumX, sumY, sumXX, sumXY;
+		unsigned int lastRun;
+		unsigned char lastStatus;
+		unsigned int flips;
+		unsigned int failures;
+		/// Last durations, in a ring buffer.
+		std::vector<unsigned long long> durations;
+		unsigned int next;
+	};
+
+	/// Open addressing table of the test statistics, indexed by test id.
+	class StatsTable
+	{
+	public:
+		StatsTable()
+			: _slots(1024, -1)
+			, _stats()
+		{}
+
+		TestStats& get(unsigned long long testId)
+		{
+			size_t mask = _slots.size() - 1;
+			size_t slot = (size_t)(testId ^ (testId >> 32)) & mask;
+			while(_slots[slot] >= 0)
+			{
+				if(_stats[_slots[slot]].testId == testId)
+					return _stats[_slots[slot]];
+				slot = (slot + 1) & mask;
+			}
+
+			_slots[slot] = _stats.size();
+			_stats.push_back(TestStats());
+			_stats.back().testId = testId;
+			if(_stats.size() * 2 > _slots.size())
+				grow();
+			return _stats[_stats.size() - 1];
+		}
+
+		std::vector<TestStats>& stats()
+		{
+			return _stats;
+		}
+
+	private:
+		void grow()
+		{
+			std::vector<long> slots(_slots.size() * 2, -1);
+			size_t mask = slots.size() - 1;
+			for(size_t index = 0; index < _stats.size(); ++index)
+			{
+				unsigned long long testId = _stats[index].testId;
+				size_t slot = (size_t)(testId ^ (testId >> 32)) & mask;
+				while(slots[slot] >= 0)
+					slot = (slot + 1) & mask;
+				slots[slot] = index;
+			}
+			_slots.swap(slots);
+		}
+
+	private:
+		std::vector<long> _slots;
+		std::vector<TestStats> _stats;
+	};
+
+	struct Entry
+	{
+		double score;
+		std::string text;
+
+		bool operator<(const Entry& other) const
+		{
+			return score > other.score;
+		}
+	};
+
+	unsigned long long median(std::vector<unsigned long long> values)
+	{
+		std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+		return values[values.size() / 2];
+	}
+
+	void printEntries(std::vector<Entry>& entries, unsigned int count)
+	{
+		std::sort(entries.begin(), entries.end());
+		for(size_t index = 0; index < entries.size() && index < count; ++index)
+			std::cout << entries[index].text << std::endl;
+	}
+
+	enum Query
+	{
+		Summary,
+		SlowestGrowing,
+		Flakiest,
+		Regressions
+	};
+
+	void exitHelpMessage(const std::string& program, int code = 0)
+	{
+		std::cout << program << " [options] DIR" << std::endl;
+		std::cout << "Query a CppUnit test history" << std::endl;
+		std::cout << std::endl;
+
+		std::cout << "  -h --help               Show this help message" << std::endl;
+		std::cout << "  -g --slowest-growing    List the tests whose duration grows the most per run" << std::endl;
+		std::cout << "  -f --flakiest           List the tests that change status most often" << std::endl;
+		std::cout << "  -r --regressions        List the tests of the last run slower than their median" << std::endl;
+		std::cout << "  -n --count N            Number of tests to list (default 10)" << std::endl;
+		std::cout << "  -w --window N           Number of runs of the moving median (default 20)" << std::endl;
+		std::cout << "  -t --threshold PERCENT  Slowdown reported as a regression (default 50)" << std::endl;
+
+		std::cout << std::endl;
+
+		::exit(code);
+	}
+
+	void exitErrorMessage(const std::string& program, const std::string& message)
+	{
+		std::cerr << program << ": " << message << std::endl;
+		::exit(2);
+	}
+
+	unsigned int numberValue(const std::string& program, int argc, const char* argv[], int& i)
+	{
+		std::string option = argv[i];
+		if(i + 1 >= argc)
+			exitErrorMessage(program, "missing value for option " + option);
+
+		std::string value = argv[++i];
+		char* end = NULL;
+		unsigned long number = ::strtoul(value.c_str(), &end, 10);
+		if(value.empty() || *end != '\0' || value[0] == '-')
+			exitErrorMessage(program, "invalid value for option " + option + " " + value);
+		return number;
+	}
+}
+
+int main(int argc, const char* argv[])
+{
+	std::string program = argc > 0 ? argv[0] : "cppunit_history";
+	std::string::size_type s = program.find_last_of("/\\");
+	if(s != std::string::npos)
+		program = program.substr(s + 1);
+
+	std::string directory;
+	Query query = Summary;
+	unsigned int count = 10;
+	unsigned int window = 20;
+	unsigned int threshold = 50;
+
+	for(int i = 1; i < argc; ++i)
+	{
+		std::string option = argv[i];
+		if(option == "-h" || option == "--help")
+			exitHelpMessage(program);
+		else if(option == "-g" || option == "--slowest-growing")
+			query = SlowestGrowing;
+		else if(option == "-f" || option == "--flakiest")
+			query = Flakiest;
+		else if(option == "-r" || option == "--regressions")
+			query = Regressions;
+		else if(option == "-n" || option == "--count")
+			count = numberValue(program, argc, argv, i);
+		else if(option == "-w" || option == "--window")
+			window = numberValue(program, argc, argv, i);
+		else if(option == "-t" || option == "--threshold")
+			threshold = numberValue(program, argc, argv, i);
+		else if(option.compare(0, 1, "-") == 0)
+			exitErrorMessage(program, "invalid option " + option);
+		else if(directory.empty())
+			directory = option;
+		else
+			exitErrorMessage(program, "unexpected argument " + option);
+	}
+
+	if(directory.empty())
+		exitHelpMessage(program, 1);
+	if(window == 0)
+		window = 1;
+
+	try
+	{
+		CppUnit::TestHistory history(directory);
+		history.load();
+
+		size_t rowCount = history.rowCount();
+		const unsigned int* runIds = history.runIds();
+		const unsigned long long* testIds = history.testIds();
+		const unsigned char* statuses = history.statuses();
+		const unsigned long long* durations = history.durations();
+
+		// Each query scans only the columns it needs.
+		StatsTable table;
+		for(size_t row = 0; row < rowCount; ++row)
+		{
+			TestStats& stats = table.get(testIds[row]);
+			unsigned int runId = runIds[row];
+
+			if(query == SlowestGrowing)
+			{
+				double x = runId;
+				double y = durations[row];
+				stats.sumX += x;
+				stats.sumY += y;
+				stats.sumXX += x * x;
+				stats.sumXY += x * y;
+			}
+			else if(query == Flakiest)
+			{
+				unsigned char status = statuses[row] == CppUnit::TestRecord::success ? 0 : 1;
+				if(stats.count > 0 && status != stats.lastStatus)
+					++stats.flips;
+				stats.failures += status;
+				stats.lastStatus = status;
+			}
+			else if(query == Regressions)
+			{
+				if(stats.durations.size() < window + 1)
+					stats.durations.push_back(durations[row]);
+				else
+					stats.durations[stats.next] = durations[row];
+				stats.next = (stats.next + 1) % (window + 1);
+			}
+
+			stats.lastRun = runId;
+			++stats.count;
+		}
+
+		std::vector<TestStats>& tests = table.stats();
+		std::vector<Entry> entries;
+		std::cout << std::fixed << std::setprecision(3);
+
+		if(query == Summary)
+		{
+			std::cout << "Runs: " << history.runCount() << "   Tests: " << tests.size() << "   Results: " << rowCount << std::endl;
+		}
+		else if(query == SlowestGrowing)
+		{
+			for(std::vector<TestStats>::const_iterator it = tests.begin(); it != tests.end(); ++it)
+			{
+				double n = it->count;
+				double denominator = n * it->sumXX - it->sumX * it->sumX;
+				if(it->count < 3 || denominator <= 0)
+					continue;
+
+				Entry entry;
+				entry.score = (n * it->sumXY - it->sumX * it->sumY) / denominator;
+				if(entry.score <= 0)
+					continue;
+				std::ostringstream text;
+				text << std::fixed << std::setprecision(3) << std::showpos << entry.score / 1000 << std::noshowpos
+					<< " ms/run  " << history.testName(it->testId);
+				entry.text = text.str();
+				entries.push_back(entry);
+			}
+			printEntries(entries, count);
+		}
+		else if(query == Flakiest)
+		{
+			for(std::vector<TestStats>::const_iterator it = tests.begin(); it != tests.end(); ++it)
+			{
+				if(it->flips == 0)
+					continue;
+
+				Entry entry;
+				entry.score = (double)it->flips / it->count;
+				std::ostringstream text;
+				text << it->flips << " flips in " << it->count << " runs, "
+					<< (100 * it->failures / it->count) << "% failed  " << history.testName(it->testId);
+				entry.text = text.str();
+				entries.push_back(entry);
+			}
+			printEntries(entries, count);
+		}
+		else if(query == Regressions)
+		{
+			unsigned int lastRun = history.runCount() - 1;
+			for(std::vector<TestStats>::const_iterator it = tests.begin(); it != tests.end(); ++it)
+			{
+				if(it->lastRun != lastRun || it->durations.size() < 4)
+					continue;
+
+				// The most recent duration is compared to the median of the ones before it.
+				size_t last = (it->next + it->durations.size() - 1) % it->durations.size();
+				std::vector<unsigned long long> previous;
+				for(size_t index = 0; index < it->durations.size(); ++index)
+				{
+					if(index != last)
+						previous.push_back(it->durations[index]);
+				}
+
+				unsigned long long reference = median(previous);
+				unsigned long long duration = it->durations[last];
+				if(duration * 100 <= reference * (100 + threshold) || reference == 0)
+					continue;
+
+				Entry entry;
+				entry.score = (double)duration / reference;
+				std::ostringstream text;
+				text << std::fixed << std::setprecision(3) << duration / 1000.0 << " ms (median "
+					<< reference / 1000.0 << " ms, x" << std::setprecision(2) << entry.score << ")  "
+					<< history.testName(it->testId);
+				entry.text = text.str();
+				entries.push_back(entry);
+			}
+			printEntries(entries, count);
+			return entries.empty() ? 0 : 1;
+		}
+	}
+	catch(std::exception& e)
+	{
+		exitErrorMessage(program, e.what());
+	}
+
+	return 0;
+}
@@ -0,0 +1,693 @@
+#include <cppunit/BinaryResultWriter.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/Exception.h>
+#include <cppunit/JournalListener.h>
+#include <cppunit/TestFailure.h>
+#include <cppunit/TestJournal.h>
+#include <cppunit/TestLeaf.h>
+#include <cppunit/TestNameFilter.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TextOutputter.h>
+#include <cppunit/XmlOutputter.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/plugin/PlugInManager.h>
+#include <cppunit/plugin/TestManifest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#endif
+
+namespace
+{
+	/// Stands for a test that is only known by its recorded result.
+	class RecordedTest : public CppUnit::TestLeaf
+	{
+	public:
+		RecordedTest(const std::string& name)
+			: _name(name)
+		{}
+
+		void run(CppUnit::TestResult*)
+		{}
+
+		std::string getName() const
+		{
+			return _name;
+		}
+
+		std::string getScopedName() const
+		{
+			return _name;
+		}
+
+	private:
+		std::string _name;
+	};
+
+	/// A plug-in to run, and the worker process running it.
+	struct PlugIn
+	{
+		std::string fileName;
+		std::string parameters;
+		/// Library name, the namespace of the tests of the plug-in.
+		std::string name;
+		std::string journalFile;
+		pid_t pid;
+		int status;
+		/// In watch mode, the copy of the library that is loaded.
+		std::string loadedFile;
+		/// In watch mode, whether the library changed since it was loaded.
+		bool changed;
+	};
+
+	/// Selects the test cases listed in a manifest.
+	class ManifestFilter : public CppUnit::TestFilter
+	{
+	public:
+		ManifestFilter(const CppUnit::TestManifest& manifest)
+		{
+			const CppUnit::TestManifest::Entries& entries = manifest.entries();
+			for(CppUnit::TestManifest::Entries::const_iterator it = entries.begin(); it != entries.end(); ++it)
+				_names.insert(it->name);
+		}
+
+		bool accept(CppUnit::Test* test) const
+		{
+			return _names.find(test->getScopedName()) != _names.end();
+		}
+
+	private:
+		std::set<std::string> _names;
+	};
+
+	enum Format
+	{
+		Summary,
+		Text,
+		Compiler,
+		Xml
+	};
+
+	void exitHelpMessage(const std::string& program, int code = 0)
+	{
+		std::cout << program << " [options] PLUGIN[=PARAMETERS]..." << std::endl;
+		std::cout << "Run the tests of CppUnit plug-ins, each in its own worker process" << std::endl;
+		std::cout << std::endl;
+
+		std::cout << "  -h --help               Show this help message" << std::endl;
+		std::cout << "  -j --jobs N             Run N plug-ins at a time (default: number of CPUs)" << std::endl;
+		std::cout << "  -f --filter PATTERNS    Run only the tests matching PATTERNS (see cppunit_test -h)," << std::endl;
+		std::cout << "                          with or without the library name: libfoo::FooTest::*" << std::endl;
+		std::cout << "  -L --list               List the tests of the plug-ins, from their manifest when it is" << std::endl;
+		std::cout << "                          up to date, without running them" << std::endl;
+		std::cout << "  -m --write-manifest     Write the manifest of each plug-in, with the durations of the run" << std::endl;
+		std::cout << "  -w --watch              Run the plug-ins in this process, then reload a plug-in and run" << std::endl;
+		std::cout << "                          its tests again each time its file changes (Linux only)" << std::endl;
+		std::cout << "  -l --lazy-load          Bind the plug-in symbols lazily, keep them local, and initialize" << std::endl;
+		std::cout << "                          a plug-in only once one of its suites is selected" << std::endl;
+		std::cout << "  -o --output FILE        Write the results into a binary result file" << std::endl;
+		std::cout << "  -s --summary            Print the number of tests run, failures and errors" << std::endl;
+		std::cout << "  -t --text               Print the results as text (default)" << std::endl;
+		std::cout << "  -c --compiler           Print the results in a compiler compatible format" << std::endl;
+		std::cout << "  -x --xml                Print the results as xml" << std::endl;
+		std::cout << "  -q --quiet              Do not print the results" << std::endl;
+
+		std::cout << std::endl;
+
+		::exit(code);
+	}
+
+	void exitErrorMessage(const std::string& program, const std::string& message)
+	{
+		std::cerr << program << ": " << message << std::endl;
+		::exit(2);
+	}
+
+	/// Returns the file name without its directory and extensions.
+	std::string libraryName(const std::string& fileName)
+	{
+		std::string name = fileName;
+		std::string::size_type s = name.find_last_of("/\\");
+		if(s != std::string::npos)
+			name = name.substr(s + 1);
+		std::string::size_type dot = name.find('.');
+		if(dot != std::string::npos && dot > 0)
+			name = name.substr(0, dot);
+		return name;
+	}
+
+	std::string makeTemporaryFile()
+	{
+		const char* directory = ::getenv("TMPDIR");
+		std::string fileName = std::string(directory && *directory ? directory : "/tmp") + "/cppunit_plugin_XXXXXX";
+		std::vector<char> buffer(fileName.begin(), fileName.end());
+		buffer.push_back('\0');
+
+		int fd = ::mkstemp(&buffer[0]);
+		if(fd < 0)
+			throw std::runtime_error("failed to create a temporary file in <" + fileName.substr(0, fileName.find_last_of('/')) + ">");
+		::close(fd);
+		return &buffer[0];
+	}
+
+	/// Runs the tests of a plug-in in the worker process. Returns the exit code.
+	int runPlugIn(const PlugIn& plugIn, const std::vector<std::string>& filters, int loadFlags, bool writeManifest)
+	{
+		try
+		{
+			CppUnit::PlugInManager manager;
+			manager.load(plugIn.fileName, CppUnit::PlugInParameters(plugIn.parameters), loadFlags);
+
+			CppUnit::TestNameFilter filter;
+			filter.setScope(plugIn.name + "::");
+			for(std::vector<std::string>::const_iterator it = filters.begin(); it != filters.end(); ++it)
+				filter.addPatterns(*it);
+
+			CppUnit::JournalListener journal(plugIn.journalFile);
+			CppUnit::TestResultCollector collector;
+			CppUnit::TestResult controller;
+			controller.addListener(&journal);
+			if(writeManifest)
+				controller.addListener(&collector);
+			if(! filters.empty())
+				controller.addFilter(&filter);
+			manager.addListener(&controller);
+
+			CppUnit::Test* root = CppUnit::TestFactoryRegistry::getRegistry().makeTest();
+			controller.runTest(root);
+
+			manager.removeListener(&controller);
+
+			if(writeManifest)
+			{
+				// The tests that were not run keep the durations of the previous manifest.
+				CppUnit::TestManifest manifest;
+				manager.addTests(plugIn.fileName, root, manifest);
+				for(unsigned int index = 0; index < collector.tests().size(); ++index)
+					manifest.setDuration(collector.tests()[index]->getScopedName(), collector.testDurations()[index]);
+
+				CppUnit::TestManifest previous;
+				previous.read(CppUnit::TestManifest::fileName(plugIn.fileName));
+				manifest.mergeDurations(previous);
+				manifest.write(CppUnit::TestManifest::fileName(plugIn.fileName));
+			}
+			delete root;
+		}
+		catch(std::exception& e)
+		{
+			std::cerr << plugIn.fileName << ": " << e.what() << std::endl;
+			return 1;
+		}
+		return 0;
+	}
+
+	void startWorker(PlugIn& plugIn, const std::vector<std::string>& filters, int loadFlags, bool writeManifest)
+	{
+		std::cout.flush();
+		std::cerr.flush();
+		::fflush(NULL);
+
+		pid_t pid = ::fork();
+		if(pid < 0)
+			throw std::runtime_error("failed to start a worker process for <" + plugIn.fileName + ">");
+
+		if(pid == 0)
+		{
+			// The worker must not run the destructors of the objects it shares with the runner.
+			int code = runPlugIn(plugIn, filters, loadFlags, writeManifest);
+			std::cout.flush();
+			std::cerr.flush();
+			::fflush(NULL);
+			::_exit(code);
+		}
+		plugIn.pid = pid;
+	}
+
+	/// Describes how a worker process ended, empty if it succeeded.
+	std::string describeStatus(int status)
+	{
+		std::ostringstream description;
+		if(WIFSIGNALED(status))
+			description << "the worker process was terminated by signal " << WTERMSIG(status);
+		else if(WIFEXITED(status) && WEXITSTATUS(status) != 0)
+			description << "the worker process exited with status " << WEXITSTATUS(status);
+		return description.str();
+	}
+
+	/// Prints the tests of the plug-ins, named in their namespace. Returns the exit code.
+	int listTests(const std::vector<PlugIn>& plugIns, const std::vector<std::string>& filters, int loadFlags)
+	{
+		CppUnit::PlugInManager manager;
+		for(std::vector<PlugIn>::const_iterator it = plugIns.begin(); it != plugIns.end(); ++it)
+		{
+			CppUnit::TestNameFilter filter;
+			filter.setScope(it->name + "::");
+			for(std::vector<std::string>::const_iterator pattern = filters.begin(); pattern != filters.end(); ++pattern)
+				filter.addPatterns(*pattern);
+
+			CppUnit::TestManifest manifest;
+			try
+			{
+				manager.listTests(it->fileName, manifest, CppUnit::PlugInParameters(it->parameters), loadFlags);
+			}
+			catch(std::exception& e)
+			{
+				std::cerr << it->fileName << ": " << e.what() << std::endl;
+				return 1;
+			}
+
+			const CppUnit::TestManifest::Entries& entries = manifest.entries();
+			for(CppUnit::TestManifest::Entries::const_iterator entry = entries.begin(); entry != entries.end(); ++entry)
+			{
+				RecordedTest test(entry->name);
+				if(filters.empty() || filter.accept(&test))
+					std::cout << it->name << "::" << entry->name << std::endl;
+			}
+		}
+		return 0;
+	}
+
+	void printResults(CppUnit::TestResultCollector& collector, Format format)
+	{
+		if(format == Summary)
+		{
+			std::cout << "Run: " << collector.runTests() << "   Failures: " << collector.testFailures()
+				<< "   Errors: " << collector.testErrors() << std::endl;
+		}
+		else
+		{
+			CppUnit::Outputter* outputter = NULL;
+			if(format == Text)
+				outputter = new CppUnit::TextOutputter(&collector, std::cout);
+			else if(format == Compiler)
+				outputter = new CppUnit::CompilerOutputter(&collector, std::cout);
+			else
+				outputter = new CppUnit::XmlOutputter(&collector, std::cout);
+			outputter->write();
+			delete outputter;
+		}
+		std::cout.flush();
+	}
+
+	/*! Loads a private copy of the plug-in.
+	 *
+	 * The dynamic loader returns the library already loaded for a path, and
+	 * may not be able to release a library. Loading a copy with a new name
+	 * ensures that the rebuilt library is the one loaded, and that the linker
+	 * can overwrite the file while it is in use.
+	 */
+	void loadCopy(CppUnit::PlugInManager& manager, PlugIn& plugIn, int loadFlags)
+	{
+		int input = ::open(plugIn.fileName.c_str(), O_RDONLY | O_CLOEXEC);
+		if(input < 0)
+			throw std::runtime_error("failed to open <" + plugIn.fileName + ">");
+
+		std::string copy = makeTemporaryFile();
+		int output = ::open(copy.c_str(), O_WRONLY | O_TRUNC | O_CLOEXEC);
+		char buffer[64 * 1024];
+		ssize_t size = 0;
+		bool copied = output >= 0;
+		while(copied && (size = ::read(input, buffer, sizeof(buffer))) > 0)
+			copied = ::write(output, buffer, size) == size;
+		copied = copied && size == 0;
+		::close(input);
+		if(output >= 0)
+			::close(output);
+
+		try
+		{
+			if(! copied)
+				throw std::runtime_error("failed to copy <" + plugIn.fileName + ">");
+			// The copy must not see the symbols of the previous copies.
+			manager.load(copy, CppUnit::PlugInParameters(plugIn.parameters), loadFlags | CppUnit::PlugInManager::localSymbols);
+		}
+		catch(...)
+		{
+			::unlink(copy.c_str());
+			throw;
+		}
+		::unlink(copy.c_str());
+		plugIn.loadedFile = copy;
+	}
+
+	/// Runs the tests of a loaded plug-in in the runner process and prints them.
+	void runLoaded(CppUnit::PlugInManager& manager, const PlugIn& plugIn, const std::vector<std::string>& filters, Format format)
+	{
+		CppUnit::Test* root = CppUnit::TestFactoryRegistry::getRegistry().makeTest();
+		CppUnit::TestManifest manifest;
+		manager.addTests(plugIn.loadedFile, root, manifest);
+
+		ManifestFilter plugInFilter(manifest);
+		CppUnit::TestNameFilter filter;
+		filter.setScope(plugIn.name + "::");
+		for(std::vector<std::string>::const_iterator it = filters.begin(); it != filters.end(); ++it)
+			filter.addPatterns(*it);
+
+		CppUnit::TestResultCollector collector;
+		CppUnit::TestResult controller;
+		controller.addListener(&collector);
+		controller.addFilter(&plugInFilter);
+		if(! filters.empty())
+			controller.addFilter(&filter);
+		manager.addListener(&controller);
+		controller.runTest(root);
+		manager.removeListener(&controller);
+		delete root;
+
+		std::cout << plugIn.fileName << ":" << std::endl;
+		printResults(collector, format);
+	}
+
+	/// Returns the path of a file, with a directory.
+	std::string watchedPath(const std::string& fileName)
+	{
+		return fileName.find('/') == std::string::npos ? "./" + fileName : fileName;
+	}
+
+	/*! Runs the plug-ins in the runner process, then waits for their files to
+	 * change to reload them and run their tests again. Only returns on error.
+	 */
+	int watchPlugIns(std::vector<PlugIn>& plugIns, const std::vector<std::string>& filters, int loadFlags, Format format)
+	{
+#if defined(__linux__)
+		int watcher = ::inotify_init1(IN_CLOEXEC);
+		if(watcher < 0)
+			throw std::runtime_error("failed to watch the plug-ins");
+
+		// Directories are watched: the linker usually replaces the file instead of rewriting it.
+		std::map<int, std::string> directories;
+		for(std::vector<PlugIn>::iterator it = plugIns.begin(); it != plugIns.end(); ++it)
+		{
+			std::string path = watchedPath(it->fileName);
+			std::string directory = path.substr(0, path.find_last_of('/') + 1);
+			int descriptor = ::inotify_add_watch(watcher, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+			if(descriptor < 0)
+				throw std::runtime_error("failed to watch <" + directory + ">");
+			directories[descriptor] = directory;
+			it->changed = true;
+		}
+
+		CppUnit::PlugInManager manager;
+		for(;;)
+		{
+			for(std::vector<PlugIn>::iterator it = plugIns.begin(); it != plugIns.end(); ++it)
+			{
+				if(! it->changed)
+					continue;
+				it->changed = false;
+				try
+				{
+					if(! it->loadedFile.empty())
+						manager.unload(it->loadedFile);
+					it->loadedFile.clear();
+					loadCopy(manager, *it, loadFlags);
+					runLoaded(manager, *it, filters, format);
+				}
+				catch(std::exception& e)
+				{
+					std::cerr << it->fileName << ": " << e.what() << std::endl;
+				}
+			}
+
+			// Waits for a change, then for the writes to settle.
+			int timeout = -1;
+			for(;;)
+			{
+				pollfd descriptor = { watcher, POLLIN, 0 };
+				int count = ::poll(&descriptor, 1, timeout);
+				if(count < 0 && errno == EINTR)
+					continue;
+				if(count < 0)
+					return 2;
+				if(count == 0)
+					break;
+
+				char buffer[16 * 1024];
+				ssize_t size = ::read(watcher, buffer, sizeof(buffer));
+				for(ssize_t offset = 0; offset < size; )
+				{
+					const inotify_event* event = (const inotify_event*)(buffer + offset);
+					offset += sizeof(inotify_event) + event->len;
+					if(event->len == 0)
+						continue;
+
+					std::string path = directories[event->wd] + event->name;
+					for(std::vector<PlugIn>::iterator it = plugIns.begin(); it != plugIns.end(); ++it)
+					{
+						if(watchedPath(it->fileName) == path)
+						{
+							it->changed = true;
+							timeout = 200;
+						}
+					}
+				}
+			}
+		}
+#else
+		throw std::runtime_error("--watch is not supported on this platform");
+#endif
+	}
+
+	/// Reads the results of a plug-in, named in its namespace.
+	void readResults(const PlugIn& plugIn, std::vector<CppUnit::TestRecord>& records)
+	{
+		std::string status = describeStatus(plugIn.status);
+		bool reported = false;
+
+		try
+		{
+			CppUnit::TestJournal journal(plugIn.journalFile, true);
+			const CppUnit::TestJournal::Records& journalRecords = journal.records();
+			for(CppUnit::TestJournal::Records::const_iterator it = journalRecords.begin(); it != journalRecords.end(); ++it)
+			{
+				CppUnit::TestRecord record = *it;
+				record.name = plugIn.name + "::" + record.name;
+				if(record.status == CppUnit::TestRecord::running)
+				{
+					record.status = CppUnit::TestRecord::error;
+					record.shortDescription = "test did not complete";
+					record.details.push_back(status.empty() ? "the worker process terminated while running the test" : status);
+					reported = true;
+				}
+				records.push_back(record);
+			}
+		}
+		catch(std::exception&)
+		{
+			// The worker failed before it created the journal.
+		}
+
+		if(! status.empty() && ! reported)
+		{
+			CppUnit::TestRecord record;
+			record.name = plugIn.name;
+			record.status = CppUnit::TestRecord::error;
+			record.shortDescription = "plug-in did not complete";
+			record.details.push_back(status);
+			records.push_back(record);
+		}
+	}
+}
+
+int main(int argc, const char* argv[])
+{
+	std::string program = argc > 0 ? argv[0] : "cppunit_plugin_runner";
+	std::string::size_type s = program.find_last_of("/\\");
+	if(s != std::string::npos)
+		program = program.substr(s + 1);
+
+	std::vector<PlugIn> plugIns;
+	std::vector<std::string> filters;
+	std::string output;
+	Format format = Text;
+	bool doPrint = true;
+	int loadFlags = 0;
+	bool doList = false;
+	bool doWatch = false;
+	bool writeManifest = false;
+	long jobs = ::sysconf(_SC_NPROCESSORS_ONLN);
+
+	for(int i = 1; i < argc; ++i)
+	{
+		std::string option = argv[i];
+		if(option == "-h" || option == "--help")
+			exitHelpMessage(program);
+		else if(option == "-j" || option == "--jobs" || option == "-f" || option == "--filter" || option == "-o" || option == "--output")
+		{
+			if(i + 1 >= argc)
+				exitErrorMessage(program, "missing value for option " + option);
+			std::string value = argv[++i];
+
+			if(option == "-j" || option == "--jobs")
+			{
+				char* end = NULL;
+				jobs = ::strtol(value.c_str(), &end, 10);
+				if(value.empty() || *end != '\0' || jobs < 1)
+					exitErrorMessage(program, "invalid value for option " + option + ": " + value);
+			}
+			else if(option == "-f" || option == "--filter")
+				filters.push_back(value);
+			else
+				output = value;
+		}
+		else if(option == "-L" || option == "--list")
+			doList = true;
+		else if(option == "-m" || option == "--write-manifest")
+			writeManifest = true;
+		else if(option == "-w" || option == "--watch")
+			doWatch = true;
+		else if(option == "-l" || option == "--lazy-load")
+			loadFlags = CppUnit::PlugInManager::lazyBinding | CppUnit::PlugInManager::localSymbols | CppUnit::PlugInManager::deferInitialize;
+		else if(option == "-s" || option == "--summary")
+			format = Summary;
+		else if(option == "-t" || option == "--text")
+			format = Text;
+		else if(option == "-c" || option == "--compiler")
+			format = Compiler;
+		else if(option == "-x" || option == "--xml")
+			format = Xml;
+		else if(option == "-q" || option == "--quiet")
+			doPrint = false;
+		else if(option.compare(0, 1, "-") == 0)
+			exitErrorMessage(program, "invalid option " + option);
+		else
+		{
+			PlugIn plugIn;
+			std::string::size_type equal = option.find('=');
+			plugIn.fileName = option.substr(0, equal);
+			if(equal != std::string::npos)
+				plugIn.parameters = option.substr(equal + 1);
+			plugIn.name = libraryName(plugIn.fileName);
+			plugIn.pid = 0;
+			plugIn.status = 0;
+			plugIn.changed = false;
+			plugIns.push_back(plugIn);
+		}
+	}
+
+	if(plugIns.empty())
+		exitHelpMessage(program, 1);
+	if(jobs < 1)
+		jobs = 1;
+
+	// Checked before any worker starts, so that a bad filter is reported once.
+	try
+	{
+		CppUnit::TestNameFilter filter;
+		for(std::vector<std::string>::const_iterator it = filters.begin(); it != filters.end(); ++it)
+			filter.addPatterns(*it);
+	}
+	catch(std::exception& e)
+	{
+		exitErrorMessage(program, e.what());
+	}
+
+	if(doList)
+		return listTests(plugIns, filters, loadFlags);
+
+	if(doWatch)
+	{
+		try
+		{
+			return watchPlugIns(plugIns, filters, loadFlags, format);
+		}
+		catch(std::exception& e)
+		{
+			exitErrorMessage(program, e.what());
+		}
+	}
+
+	try
+	{
+		unsigned int next = 0;
+		long running = 0;
+		while(next < plugIns.size() || running > 0)
+		{
+			for(; next < plugIns.size() && running < jobs; ++next, ++running)
+			{
+				plugIns[next].journalFile = makeTemporaryFile();
+				startWorker(plugIns[next], filters, loadFlags, writeManifest);
+			}
+
+			int status = 0;
+			pid_t pid = ::waitpid(-1, &status, 0);
+			if(pid < 0)
+				break;
+			for(std::vector<PlugIn>::iterator it = plugIns.begin(); it != plugIns.end(); ++it)
+			{
+				if(it->pid == pid)
+				{
+					it->status = status;
+					--running;
+				}
+			}
+		}
+	}
+	catch(std::exception& e)
+	{
+		exitErrorMessage(program, e.what());
+	}
+
+	// The results are merged in the order of the plug-ins, whatever the order the workers ended.
+	std::vector<CppUnit::TestRecord> records;
+	for(std::vector<PlugIn>::const_iterator it = plugIns.begin(); it != plugIns.end(); ++it)
+	{
+		readResults(*it, records);
+		if(! it->journalFile.empty())
+			::unlink(it->journalFile.c_str());
+	}
+
+	if(! output.empty())
+	{
+		std::ofstream outputStream(output.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+		if(! outputStream)
+			exitErrorMessage(program, "failed to create <" + output + ">");
+		CppUnit::BinaryResultWriter writer(outputStream);
+		for(std::vector<CppUnit::TestRecord>::const_iterator it = records.begin(); it != records.end(); ++it)
+			writer.write(*it);
+	}
+
+	CppUnit::TestResultCollector collector;
+	std::vector<RecordedTest*> tests;
+	for(std::vector<CppUnit::TestRecord>::const_iterator it = records.begin(); it != records.end(); ++it)
+	{
+		RecordedTest* test = new RecordedTest(it->name);
+		tests.push_back(test);
+		collector.startTest(test);
+		if(it->isFailure())
+		{
+			CppUnit::TestFailure failure(test, it->makeException(), it->status == CppUnit::TestRecord::error);
+			failure.setCapturedOutput(it->capturedOutput);
+			collector.addFailure(failure);
+		}
+		collector.endTest(test);
+	}
+
+	if(doPrint)
+		printResults(collector, format);
+
+	bool wasSuccessful = collector.wasSuccessful();
+	for(std::vector<RecordedTest*>::iterator it = tests.begin(); it != tests.end(); ++it)
+		delete *it;
+
+	return wasSuccessful ? 0 : 1;
+}
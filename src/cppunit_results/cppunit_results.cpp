@@ -0,0 +1,210 @@
+#include <cppunit/BinaryResultReader.h>
+#include <cppunit/BinaryResultWriter.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/Exception.h>
+#include <cppunit/TestFailure.h>
+#include <cppunit/TestLeaf.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TextOutputter.h>
+#include <cppunit/XmlOutputter.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+	/// Stands for a test that is only known by its recorded result.
+	class RecordedTest : public CppUnit::TestLeaf
+	{
+	public:
+		RecordedTest(const std::string& name)
+			: _name(name)
+		{}
+
+		void run(CppUnit::TestResult*)
+		{}
+
+		std::string getName() const
+		{
+			return _name;
+		}
+
+		std::string getScopedName() const
+		{
+			return _name;
+		}
+
+	private:
+		std::string _name;
+	};
+
+	enum Format
+	{
+		Summary,
+		Text,
+		Compiler,
+		Xml
+	};
+
+	void exitHelpMessage(const std::string& program, int code = 0)
+	{
+		std::cout << program << " [options] FILE..." << std::endl;
+		std::cout << "Merge and convert CppUnit binary result files" << std::endl;
+		std::cout << std::endl;
+
+		std::cout << "  -h --help               Show this help message" << std::endl;
+		std::cout << "  -o --output FILE        Merge the results into a binary result file" << std::endl;
+		std::cout << "  -s --summary            Print the number of tests run, failures and errors" << std::endl;
+		std::cout << "  -t --text               Print the results as text" << std::endl;
+		std::cout << "  -c --compiler           Print the results in a compiler compatible format" << std::endl;
+		std::cout << "  -x --xml                Print the results as xml" << std::endl;
+		std::cout << "  -q --quiet              Do not print the results" << std::endl;
+
+		std::cout << std::endl;
+
+		::exit(code);
+	}
+
+	void exitErrorMessage(const std::string& program, const std::string& message)
+	{
+		std::cerr << program << ": " << message << std::endl;
+		::exit(2);
+	}
+}
+
+int main(int argc, const char* argv[])
+{
+	std::string program = argc > 0 ? argv[0] : "cppunit_results";
+	std::string::size_type s = program.find_last_of("/\\");
+	if(s != std::string::npos)
+		program = program.substr(s + 1);
+
+	std::vector<std::string> inputs;
+	std::string output;
+	Format format = Summary;
+	bool doPrint = true;
+
+	for(int i = 1; i < argc; ++i)
+	{
+		std::string option = argv[i];
+		if(option == "-h" || option == "--help")
+			exitHelpMessage(program);
+		else if(option == "-o" || option == "--output")
+		{
+			if(i + 1 >= argc)
+				exitErrorMessage(program, "missing value for option " + option);
+			output = argv[++i];
+		}
+		else if(option == "-s" || option == "--summary")
+			format = Summary;
+		else if(option == "-t" || option == "--text")
+			format = Text;
+		else if(option == "-c" || option == "--compiler")
+			format = Compiler;
+		else if(option == "-x" || option == "--xml")
+			format = Xml;
+		else if(option == "-q" || option == "--quiet")
+			doPrint = false;
+		else if(option.compare(0, 1, "-") == 0)
+			exitErrorMessage(program, "invalid option " + option);
+		else
+			inputs.push_back(option);
+	}
+
+	if(inputs.empty())
+		exitHelpMessage(program, 1);
+
+	std::ofstream outputStream;
+	CppUnit::BinaryResultWriter* writer = NULL;
+	if(! output.empty())
+	{
+		outputStream.open(output.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+		if(! outputStream)
+			exitErrorMessage(program, "failed to create <" + output + ">");
+		writer = new CppUnit::BinaryResultWriter(outputStream);
+	}
+
+	// Records are streamed: only the outputters that list every test keep them.
+	bool doCollect = doPrint && format != Summary;
+	CppUnit::TestResultCollector collector;
+	std::vector<RecordedTest*> tests;
+	int runTests = 0;
+	int failures = 0;
+	int errors = 0;
+	unsigned long long duration = 0;
+
+	for(std::vector<std::string>::const_iterator it = inputs.begin(); it != inputs.end(); ++it)
+	{
+		std::ifstream stream(it->c_str(), std::ios::in | std::ios::binary);
+		if(! stream)
+			exitErrorMessage(program, "failed to open <" + *it + ">");
+
+		try
+		{
+			CppUnit::BinaryResultReader reader(stream);
+			CppUnit::TestRecord record;
+			while(reader.read(record))
+			{
+				++runTests;
+				if(record.status == CppUnit::TestRecord::failure)
+					++failures;
+				else if(record.status != CppUnit::TestRecord::success)
+					++errors;
+				duration += record.duration;
+
+				if(writer)
+					writer->write(record);
+
+				if(doCollect)
+				{
+					RecordedTest* test = new RecordedTest(record.name);
+					tests.push_back(test);
+					collector.startTest(test);
+					if(record.isFailure())
+					{
+						CppUnit::TestFailure failure(test, record.makeException(), record.status == CppUnit::TestRecord::error);
+						failure.setCapturedOutput(record.capturedOutput);
+						collector.addFailure(failure);
+					}
+					collector.endTest(test);
+				}
+			}
+		}
+		catch(std::exception& e)
+		{
+			exitErrorMessage(program, *it + ": " + e.what());
+		}
+	}
+
+	delete writer;
+
+	if(doPrint)
+	{
+		if(format == Summary)
+		{
+			std::cout << "Run: " << runTests << "   Failures: " << failures << "   Errors: " << errors
+				<< "   Time: " << (duration / 1000) / 1000.0 << "s" << std::endl;
+		}
+		else
+		{
+			CppUnit::Outputter* outputter = NULL;
+			if(format == Text)
+				outputter = new CppUnit::TextOutputter(&collector, std::cout);
+			else if(format == Compiler)
+				outputter = new CppUnit::CompilerOutputter(&collector, std::cout);
+			else
+				outputter = new CppUnit::XmlOutputter(&collector, std::cout);
+			outputter->write();
+			delete outputter;
+		}
+	}
+
+	for(std::vector<RecordedTest*>::iterator it = tests.begin(); it != tests.end(); ++it)
+		delete *it;
+
+	return failures + errors == 0 ? 0 : 1;
+}
@@ -1,6 +1,15 @@
 #include "cppunit/CppUnit.h"
+#include "cppunit/TestCaseTable.h"
+#include "cppunit/TestFailure.h"
+#include "cppunit/TestPath.h"
+#include "cppunit/TestResult.h"
+#include "cppunit/extensions/HelperMacros.h"
+#include "cppunit/extensions/TestRegistrationTable.h"
+#include "cppunit/tools/OutputCapture.h"
 #include "cppunit/TestResultCollector.h"
 #include "cppunit/ui/text/TestRunner.h"
+#include <cstdio>
+#include <stdexcept>
 
 class FooTest : public CppUnit::TestFixture
 {
@@ -130,12 +139,348 @@ public:
 	}
 };
 
+class CaptureTest : public CppUnit::TestFixture
+{
+public:
+	void testQuiet()
+	{
+		std::cout << "output of testQuiet" << std::endl;
+		assert_true(true);
+	}
+	void testNoisy()
+	{
+		std::cout << "output of testNoisy" << std::endl;
+		throw std::runtime_error("noisy");
+	}
+	void testLimit()
+	{
+		// More than a pipe holds: the output is drained while it is written.
+		CppUnit::OutputCapture capture(8);
+		capture.start();
+		std::string line(1024 * 1024 - 1, 'x');
+		for(int index = 0; index < 4; ++index)
+			std::cout << line << std::endl;
+		std::cout << "tail" << std::endl;
+		assert_equal("[... 4194301 bytes truncated ...]\nxx\ntail\n", capture.stop());
+	}
+
+	static CppUnit::Test* suite()
+	{
+		CPPUNIT_DEFINE_SUITE(suite, CaptureTest);
+		CPPUNIT_ADD_TEST(suite, testQuiet);
+		CPPUNIT_ADD_TEST(suite, testNoisy);
+		CPPUNIT_ADD_TEST(suite, testLimit);
+
+		return suite;
+	}
+};
+
+class BazTest : public CppUnit::TestFixture
+{
+public:
+	void testOk()
+	{
+		assert_true(true);
+	}
+	void testStrings()
+	{
+		assert_equal("baz", std::string("baz"));
+	}
+};
+
+class FailureTest : public CppUnit::TestFixture
+{
+public:
+	void testShare()
+	{
+		CppUnit::TestFailure* failure = CppUnit::TestFailure::create(NULL, new CppUnit::Exception(), false);
+		CppUnit::TestFailure* shared = failure->share();
+		assert_equal(failure, shared);
+		shared->release();
+		failure->release();
+
+		CppUnit::TestFailure local(NULL, new CppUnit::Exception(), true);
+		local.setCapturedOutput("output");
+		shared = local.share();
+		assert_true(shared != &local);
+		assert_true(shared->isError());
+		assert_equal("output", shared->capturedOutput());
+		shared->release();
+	}
+	void testUnshare()
+	{
+		CppUnit::TestFailure* failure = CppUnit::TestFailure::create(NULL, new CppUnit::Exception(), false);
+		CppUnit::TestFailure* shared = failure->share();
+		CppUnit::TestFailure* unshared = shared->unshare();
+		assert_true(unshared != failure);
+		unshared->setCapturedOutput("output");
+		assert_equal("", failure->capturedOutput());
+		unshared->release();
+
+		unshared = failure->unshare();
+		assert_equal(failure, unshared);
+		unshared->release();
+	}
+
+	static CppUnit::Test* suite()
+	{
+		CPPUNIT_DEFINE_SUITE(suite, FailureTest);
+		CPPUNIT_ADD_TEST(suite, testShare);
+		CPPUNIT_ADD_TEST(suite, testUnshare);
+
+		return suite;
+	}
+};
+
+class CollectorTest : public CppUnit::TestFixture
+{
+	class Collected : public CppUnit::TestFixture
+	{
+	public:
+		void testOk()
+		{
+		}
+		void testFail()
+		{
+			assert_true(false);
+			assert_true(false);
+		}
+		void testThrow()
+		{
+			throw 42;
+		}
+	};
+
+public:
+	void testColumns()
+	{
+		CPPUNIT_DEFINE_SUITE(suite, Collected);
+		CPPUNIT_ADD_TEST(suite, testOk);
+		CPPUNIT_ADD_TEST(suite, testFail);
+		CPPUNIT_ADD_TEST(suite, testThrow);
+		CppUnit::Test* test = suite;
+
+		CppUnit::TestResult result;
+		CppUnit::TestResultCollector collector;
+		collector.setCollectResourceUsage(true);
+		result.addListener(&collector);
+		test->run(&result);
+		collector.addCachedTest(test->getChildTestAt(0), 42);
+
+		assert_equal(4u, collector.tests().size());
+		assert_equal(4u, collector.testStatuses().size());
+		assert_equal(4u, collector.testDurations().size());
+		assert_equal(4u, collector.testFailureIndexes().size());
+		assert_equal(4u, collector.testCpuTimes().size());
+		assert_equal(4u, collector.testPeakMemories().size());
+		assert_equal(4u, collector.testCachedFlags().size());
+
+		assert_equal(CppUnit::TestRecord::success, collector.testStatuses()[0]);
+		assert_equal(CppUnit::TestRecord::failure, collector.testStatuses()[1]);
+		assert_equal(CppUnit::TestRecord::error, collector.testStatuses()[2]);
+		assert_equal(CppUnit::TestRecord::success, collector.testStatuses()[3]);
+
+		assert_equal(-1, collector.testFailureIndexes()[0]);
+		assert_equal(0, collector.testFailureIndexes()[1]);
+		assert_equal(1, collector.testFailureIndexes()[2]);
+		assert_equal(-1, collector.testFailureIndexes()[3]);
+		assert_equal(test->getChildTestAt(2), collector.failures()[1]->failedTest());
+
+		assert_false(collector.testCachedFlags()[0]);
+		assert_true(collector.testCachedFlags()[3]);
+		assert_equal(42ull, collector.testDurations()[3]);
+		assert_equal(1, collector.cachedTests());
+		assert_greater(0ull, collector.testPeakMemories()[0]);
+
+		delete test;
+	}
+
+	static CppUnit::Test* suite()
+	{
+		CPPUNIT_DEFINE_SUITE(suite, CollectorTest);
+		CPPUNIT_ADD_TEST(suite, testColumns);
+
+		return suite;
+	}
+};
+
+class AbstractTest : public CppUnit::TestFixture
+{
+	CPPUNIT_TEST_SUITE(AbstractTest);
+	CPPUNIT_TEST(testValue);
+	CPPUNIT_TEST_SUITE_END_ABSTRACT();
+
+public:
+	virtual int value() const = 0;
+
+	void testValue()
+	{
+		assert_equal(42, value());
+	}
+};
+
+class ConcreteTest : public AbstractTest
+{
+	CPPUNIT_TEST_SUB_SUITE(ConcreteTest, AbstractTest);
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+	int value() const
+	{
+		return 42;
+	}
+};
+
+class SquareTest : public CppUnit::TestFixture
+{
+public:
+	void testSquare(unsigned int n)
+	{
+		unsigned int sum = 0;
+		for(unsigned int i = 0; i < n; ++i)
+			sum += 2 * i + 1;
+		assert_equal(n * n, sum);
+	}
+
+	static CppUnit::Test* suite()
+	{
+		CppUnit::TestCallerTable<SquareTest>* table = new CppUnit::TestCallerTable<SquareTest>("SquareTest");
+		for(unsigned int n = 0; n < 10; ++n)
+		{
+			char name[32];
+			::sprintf(name, "testSquare%u", n);
+			table->addTest(name, &SquareTest::testSquare, n);
+		}
+		return table;
+	}
+};
+
+class PathTest : public CppUnit::TestFixture
+{
+	/// Runner exposing the suite that indexes the names of its tests.
+	class Runner : public CppUnit::TestRunner
+	{
+	public:
+		CppUnit::Test* suite() const
+		{
+			return m_suite;
+		}
+	};
+
+	/// Table counting the accesses to its test cases.
+	class CountedTable : public CppUnit::TestCallerTable<SquareTest>
+	{
+	public:
+		CountedTable()
+			: CppUnit::TestCallerTable<SquareTest>("CountedTest")
+			, count(0)
+		{
+		}
+
+		mutable int count;
+
+	protected:
+		CppUnit::Test* doGetChildTestAt(int index) const
+		{
+			++count;
+			return CppUnit::TestCallerTable<SquareTest>::doGetChildTestAt(index);
+		}
+	};
+
+public:
+	void testScopedName()
+	{
+		Runner runner;
+		CountedTable* table = new CountedTable();
+		for(unsigned int n = 0; n < 10; ++n)
+		{
+			char name[32];
+			::sprintf(name, "testSquare%u", n);
+			table->addTest(name, &SquareTest::testSquare, n);
+		}
+		runner.addTest(BarTest::suite());
+		runner.addTest(table);
+
+		// The first lookup builds the index, the next ones do not scan the table.
+		runner.suite()->resolveTestPath("CountedTest::testSquare7");
+		table->count = 0;
+		CppUnit::TestPath path = runner.suite()->resolveTestPath("CountedTest::testSquare7");
+		assert_less_equal(1, table->count);
+		assert_equal(2, path.getTestCount());
+		assert_true(path.getTestAt(0) == table);
+		assert_equal(std::string("CountedTest::testSquare7"), path.getChildTest()->getScopedName());
+
+		// Paths that are not a scoped name are still resolved level by level.
+		assert_true(runner.suite()->resolveTestPath("CountedTest/testSquare7").getChildTest() == path.getChildTest());
+		assert_throw(std::invalid_argument, runner.suite()->resolveTestPath("CountedTest::testSquare10"));
+	}
+
+	static CppUnit::Test* suite()
+	{
+		CPPUNIT_DEFINE_SUITE(suite, PathTest);
+		CPPUNIT_ADD_TEST(suite, testScopedName);
+
+		return suite;
+	}
+};
+
+class LazyTest : public CppUnit::TestFixture
+{
+	CPPUNIT_TEST_SUITE(LazyTest);
+	CPPUNIT_TEST_SUITE_PROPERTY("InputFiles", "cppunit_test.input");
+	CPPUNIT_TEST(testOk);
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+	LazyTest()
+	{
+		std::cout << "LazyTest fixture created" << std::endl;
+	}
+	void testOk()
+	{
+		assert_true(true);
+	}
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(LazyTest);
+
+class RegisteredTest : public CppUnit::TestFixture
+{
+public:
+	void testRegistered()
+	{
+		assert_true(true);
+	}
+
+	static CppUnit::Test* suite()
+	{
+		CPPUNIT_DEFINE_SUITE(suite, RegisteredTest);
+		CPPUNIT_ADD_TEST(suite, testRegistered);
+
+		return suite;
+	}
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(RegisteredTest);
+
+CPPUNIT_REGISTER_TEST(BazTest, testOk);
+CPPUNIT_REGISTER_TEST(BazTest, testStrings);
+
 int main(int argc, const char* argv[])
 {
 	CppUnit::TextUi::TestRunner runner;
+	CppUnit::TestRegistrationTable table("Registered Tests");
 
 	runner.addTest(FooTest::suite());
 	runner.addTest(BarTest::suite());
+	runner.addTest(CaptureTest::suite());
+	runner.addTest(FailureTest::suite());
+	runner.addTest(CollectorTest::suite());
+	runner.addTest(SquareTest::suite());
+	runner.addTest(PathTest::suite());
+	runner.addTest(ConcreteTest::suite());
+	runner.addTest(table.makeTest());
+	runner.addTest(CppUnit::TestFactoryRegistry::getRegistry().makeTest());
 	runner.run(argc, argv);
 
 	return runner.result().testFailures();
@@ -1,5 +1,8 @@
 require 'test/unit'
+require 'fileutils'
 require 'open3'
+require 'socket'
+require 'tmpdir'
 
 class CppUnitTest < Test::Unit::TestCase
 
@@ -82,6 +85,12 @@ class CppUnitTest < Test::Unit::TestCase
         assert_match(/<FailedTests>/, output)
         assert_match(/<SuccessfulTests>/, output)
       }
+
+      output = `./cppunit_test -x FooTest`
+      assert_match(/<FailedTest id="2">\s*<Name>testFail<\/Name>\s*<FailureType>Assertion<\/FailureType>/, output)
+      assert_match(/<FailedTest id="7">\s*<Name>testThrowNoAssert<\/Name>\s*<FailureType>Error<\/FailureType>/, output)
+      assert_match(/<Test id="1">\s*<Name>testOk<\/Name>/, output)
+      assert_match(/<FailuresTotal>2<\/FailuresTotal>/, output)
     }
   end
 
@@ -98,6 +107,25 @@ class CppUnitTest < Test::Unit::TestCase
       assert_no_match(/FooTest/, output)
       assert_match(/BarTest/, output)
       assert_match(/OK\s+\(1\stests\)/, output)
+
+      output = `./cppunit_test -V '/All Tests/BarTest'`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/BarTest::testOk/, output)
+      assert_match(/OK\s+\(1\stests\)/, output)
+
+      output = `./cppunit_test -V SquareTest::testSquare3`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/SquareTest::testSquare3/, output)
+      assert_match(/OK\s+\(1\stests\)/, output)
+
+      output = `./cppunit_test -V LazyTest`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/LazyTest::LazyTest::testOk/, output)
+      assert_match(/OK\s+\(1\stests\)/, output)
+
+      output = `./cppunit_test NoSuchTest 2>&1`
+      assert(! $?.success?)
+      assert_match(/No test named <NoSuchTest> found/, output)
     }
   end
 
@@ -110,6 +138,583 @@ class CppUnitTest < Test::Unit::TestCase
     }
   end
 
+  def testCppUnitFilter
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      output = `./cppunit_test -V --filter 'FooTest::test*:/BarTest::test(Ok|Fail)/:-FooTest::testFail:FooTest::testThrow*'`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/FooTest::testOk/, output)
+      assert_match(/BarTest::testOk/, output)
+      assert_no_match(/FooTest::testFail/, output)
+      assert_no_match(/FooTest::testThrow/, output)
+      assert_match(/OK\s+\(6\stests\)/, output)
+
+      output = `./cppunit_test --filter '/Foo(/' 2>&1`
+      assert_match(/RegularExpression: .*<Foo\(>/, output)
+    }
+  end
+
+  def testCppUnitTestCaseTable
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      output = `./cppunit_test -V --filter 'SquareTest::*'`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/SquareTest::testSquare0/, output)
+      assert_match(/SquareTest::testSquare9/, output)
+      assert_match(/OK\s+\(10\stests\)/, output)
+
+      output = `./cppunit_test --list-tests`
+      assert_match(/^  SquareTest: 10 tests$/, output)
+    }
+  end
+
+  def testCppUnitListTests
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      output = `./cppunit_test --list-tests`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/^  FooTest: 8 tests$/, output)
+      assert_match(/^    FooTest::testOk$/, output)
+      assert_match(/^  BarTest: 1 tests$/, output)
+      assert_match(/^  Registered Tests: 2 tests\n    BazTest: 2 tests\n      BazTest::testOk\n      BazTest::testStrings$/, output)
+      assert_no_match(/output of testQuiet/, output)
+
+      output = `./cppunit_test --list-tests-json --filter 'BarTest::*'`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/"testCount":1,/, output)
+      assert_match(/\{"name":"testOk","scopedName":"BarTest::testOk"\}/, output)
+      assert_no_match(/FooTest/, output)
+    }
+  end
+
+  def testCppUnitLazySuite
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      output = `./cppunit_test --filter 'BarTest::*'`
+      assert_equal(0, $?.exitstatus)
+      assert_no_match(/LazyTest fixture created/, output)
+
+      output = `./cppunit_test -l --filter 'FooTest::*'`
+      assert_no_match(/LazyTest/, output)
+
+      # A registered suite that is not declared with CPPUNIT_TEST_SUITE() is
+      # found by the names of its tests, which need not be scoped.
+      output = `./cppunit_test -V testRegistered`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/RegisteredTest::testRegistered/, output)
+      assert_match(/OK\s+\(1\stests\)/, output)
+      assert_no_match(/LazyTest fixture created/, output)
+      output = `./cppunit_test --filter testRegistered`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/OK\s+\(1\stests\)/, output)
+
+      # A registered suite is listed from its description, without fixtures.
+      output = `./cppunit_test --list-tests`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/^All Tests: 31 tests$/, output)
+      assert_match(/^    LazyTest: 1 tests\n      LazyTest::LazyTest::testOk$/, output)
+      assert_no_match(/lazy suite/, output)
+      assert_no_match(/LazyTest fixture created/, output)
+
+      output = `./cppunit_test --list-tests-json`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/\A\{"name":"All Tests","scopedName":"All Tests","testCount":31,/, output)
+      assert_match(/\{"name":"LazyTest","scopedName":"LazyTest","testCount":1,"tests":\[\s*\{"name":"LazyTest::testOk","scopedName":"LazyTest::LazyTest::testOk"\}\]\}/, output)
+      assert_no_match(/isLazy|isComplete/, output)
+      assert_no_match(/LazyTest fixture created/, output)
+
+      output = `./cppunit_test --list-tests --filter 'LazyTest::*'`
+      assert_match(/^    LazyTest: 1 tests\n      LazyTest::LazyTest::testOk$/, output)
+      assert_no_match(/LazyTest fixture created/, output)
+
+      output = `./cppunit_test LazyTest`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/LazyTest fixture created/, output)
+      assert_match(/OK\s+\(1\stests\)/, output)
+
+      output = `./cppunit_test --filter 'LazyTest::*'`
+      assert_match(/LazyTest fixture created/, output)
+    }
+  end
+
+  def testCppUnitFastExit
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      output = `./cppunit_test --fast-exit`
+      assert_equal(1, $?.exitstatus)
+      assert_match(/Run:\s+\d+\s+Failures:\s+1\s+Errors:\s+2/, output)
+
+      output = `./cppunit_test --fast-exit -x BarTest`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/<\/TestRun>/, output)
+    }
+  end
+
+  def testCppUnitJournal
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      begin
+        output = `./cppunit_test -V --journal cppunit_test.journal FooTest::testOk`
+        assert_equal(0, $?.exitstatus)
+        assert_match(/OK\s+\(1\stests\)/, output)
+
+        output = `./cppunit_test -V --resume cppunit_test.journal`
+        assert_equal(1, $?.exitstatus)
+        assert_no_match(/FooTest::testOk/, output)
+        assert_match(/FooTest::testFail/, output)
+        run = `./cppunit_test`[/Run:\s+(\d+)/, 1]
+        assert_match(/Run:\s+#{run}\s+/, output)
+
+        output = `./cppunit_test -V --resume cppunit_test.journal`
+        assert_equal(1, $?.exitstatus)
+        assert_no_match(/FooTest::test\w+/, output)
+        assert_match(/Run:\s+#{run}\s+/, output)
+      ensure
+        File.delete('cppunit_test.journal') if File.exist?('cppunit_test.journal')
+      end
+    }
+  end
+
+  def testCppUnitCaptureOutput
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      %w(-c --capture-output).each {|opt|
+        output = `./cppunit_test #{opt}`
+        assert_equal(1, $?.exitstatus)
+        assert_match(/^[\.FE]+$/, output)
+        assert_no_match(/output of testQuiet/, output)
+        assert_match(/Captured output:\noutput of testNoisy/, output)
+      }
+
+      output = `./cppunit_test -x -c`
+      assert_match(/<Message>.*Captured output:\noutput of testNoisy/m, output)
+
+      output = `./cppunit_test --capture-limit 6`
+      assert_match(/Captured output:\n\[\.\.\. 14 bytes truncated \.\.\.\]\nNoisy/, output)
+
+      # Without a file descriptor left to redirect the output, the tests run uncaptured.
+      output = `sh -c 'ulimit -n 4; ./cppunit_test -c BarTest'`
+      assert_match(/Run:\s+1\s+Failures:\s+0\s+Errors:\s+1/, output)
+      assert_match(/output capture failed/, output)
+    }
+  end
+
+  def testCppUnitPlugInRunner
+    runner = File.expand_path(File.join(File.dirname(__FILE__), '..', 'build', 'src', 'cppunit_plugin_runner', configuration.to_s, 'cppunit_plugin_runner'))
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      output = `#{runner} ./cppunit_test_plugin.so`
+      assert_equal(0, $?.exitstatus)
+      assert_match(/OK\s+\(2\stests\)/, output)
+
+      output = `#{runner} -j 2 ./cppunit_test_plugin.so ./cppunit_test_plugin.so=crash`
+      assert_equal(1, $?.exitstatus)
+      assert_match(/Run:\s+4\s+Failures:\s+0\s+Errors:\s+1/, output)
+      assert_match(/cppunit_test_plugin::PlugInTest::.*testParameters \(E\)\s+test did not complete/, output)
+
+      output = `#{runner} -s -f 'cppunit_test_plugin::*::testOk' ./cppunit_test_plugin.so`
+      assert_match(/Run:\s+1\s+Failures:\s+0\s+Errors:\s+0/, output)
+      assert_match(/PlugIn initialized/, output)
+
+      output = `#{runner} -s --lazy-load -f 'NoSuchTest::*' ./cppunit_test_plugin.so`
+      assert_match(/Run:\s+0\s+Failures:\s+0\s+Errors:\s+0/, output)
+      assert_no_match(/PlugIn initialized/, output)
+
+      output = `#{runner} -s --lazy-load ./cppunit_test_plugin.so=crash`
+      assert_equal(1, $?.exitstatus)
+      assert_match(/PlugIn initialized/, output)
+      assert_match(/Run:\s+2\s+Failures:\s+0\s+Errors:\s+1/, output)
+
+      # The fixtures are built once the plug-in is initialized, which reports its failure.
+      output = `#{runner} -s --lazy-load -f '*::testOk' ./cppunit_test_plugin.so`
+      assert_match(/Run:\s+1\s+Failures:\s+0\s+Errors:\s+0/, output)
+
+      output = `#{runner} --lazy-load ./cppunit_test_plugin.so=throw`
+      assert_equal(1, $?.exitstatus)
+      assert_match(/Run:\s+1\s+Failures:\s+0\s+Errors:\s+1/, output)
+      assert_match(/cppunit_test_plugin::PlugInTest \(E\)\s+failed to make the suite\n.*\n- bad parameters/, output)
+    }
+  end
+
+  def testCppUnitPlugInManifest
+    runner = File.expand_path(File.join(File.dirname(__FILE__), '..', 'build', 'src', 'cppunit_plugin_runner', configuration.to_s, 'cppunit_plugin_runner'))
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      begin
+        File.delete('cppunit_test_plugin.so.manifest') if File.exist?('cppunit_test_plugin.so.manifest')
+        output = `#{runner} --list ./cppunit_test_plugin.so`
+        assert_equal(0, $?.exitstatus)
+        assert_match(/PlugIn initialized/, output)
+        assert_match(/^cppunit_test_plugin::PlugInTest::.*testOk$/, output)
+
+        `#{runner} -q --write-manifest ./cppunit_test_plugin.so`
+        manifest = File.read('cppunit_test_plugin.so.manifest')
+        assert_match(/^build-id\t[0-9a-f]+$/, manifest)
+        assert_match(/^suite\tPlugInTest$/, manifest)
+
+        output = `#{runner} --list ./cppunit_test_plugin.so`
+        assert_no_match(/PlugIn initialized/, output)
+        assert_equal(2, output.lines.count)
+
+        output = `#{runner} -L -f '*::testParameters' ./cppunit_test_plugin.so`
+        assert_equal(1, output.lines.count)
+
+        File.write('cppunit_test_plugin.so.manifest', manifest.sub(/^build-id\t.*$/, "build-id\t0"))
+        output = `#{runner} --list ./cppunit_test_plugin.so`
+        assert_match(/PlugIn initialized/, output)
+        assert_match(/^cppunit_test_plugin::PlugInTest::.*testParameters$/, output)
+      ensure
+        File.delete('cppunit_test_plugin.so.manifest') if File.exist?('cppunit_test_plugin.so.manifest')
+      end
+    }
+  end
+
+  def testCppUnitPlugInWatch
+    runner = File.expand_path(File.join(File.dirname(__FILE__), '..', 'build', 'src', 'cppunit_plugin_runner', configuration.to_s, 'cppunit_plugin_runner'))
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      Dir.mktmpdir {|dir|
+        plugin = File.join(dir, 'cppunit_test_plugin.so')
+        FileUtils.cp('cppunit_test_plugin.so', plugin)
+        IO.popen([runner, '-s', '--watch', plugin]) {|output|
+          begin
+            assert_match(/PlugIn initialized/, output.gets)
+            assert_equal("#{plugin}:\n", output.gets)
+            assert_match(/Run:\s+2\s+Failures:\s+0\s+Errors:\s+0/, output.gets)
+
+            FileUtils.cp('cppunit_test_plugin.so', File.join(dir, 'rebuilt.so'))
+            File.rename(File.join(dir, 'rebuilt.so'), plugin)
+            assert_match(/PlugIn initialized/, output.gets)
+            assert_equal("#{plugin}:\n", output.gets)
+            assert_match(/Run:\s+2\s+Failures:\s+0\s+Errors:\s+0/, output.gets)
+          ensure
+            Process.kill('TERM', output.pid)
+          end
+        }
+      }
+    }
+  end
+
+  def testCppUnitServe
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      Dir.mktmpdir {|dir|
+        path = File.join(dir, 'cppunit_test.sock')
+        pid = spawn('./cppunit_test', '--serve', path, :out => File::NULL, :err => File::NULL)
+        begin
+          50.times { break if File.socket?(path); sleep 0.1 }
+          socket = UNIXSocket.new(path)
+          response = lambda {|request|
+            socket.puts request
+            lines = []
+            lines << socket.gets.chomp until lines.last =~ /^(result|error)\t/
+            lines
+          }
+
+          lines = response.call('BarTest')
+          assert_equal("start\tBarTest::testOk", lines[0])
+          assert_match(/^end\tBarTest::testOk\tsuccess\t\d+$/, lines[1])
+          assert_equal("result\t1\t0\t0", lines[2])
+
+          lines = response.call('-f FooTest::testFail*')
+          assert_match(/^failure\tFooTest::testFail\tassertion\t/, lines[1])
+          assert_equal("result\t1\t1\t0", lines.last)
+
+          lines = response.call('NoSuchTest')
+          assert_match(/^error\t/, lines[0])
+
+          socket.puts '--shutdown'
+          assert_nil(socket.gets)
+          Process.wait(pid)
+          pid = nil
+          assert_equal(0, $?.exitstatus)
+          assert(! File.exist?(path))
+        ensure
+          if pid
+            Process.kill('KILL', pid)
+            Process.wait(pid)
+          end
+        end
+      }
+    }
+  end
+
+  def testCppUnitCoverage
+    source = File.readlines(File.join(File.dirname(__FILE__), 'cppunit_test.cpp'))
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      Dir.mktmpdir {|dir|
+        index = File.join(dir, 'cppunit_test.coverage')
+        output = `./cppunit_test -p -r --coverage #{index} BarTest 2>&1`
+        assert_match(/no instrumented code was run/, output)
+        assert(! File.exist?(index))
+
+        next unless File.exist?('./cppunit_test_coverage')
+        bar = source.index {|line| line =~ /^class BarTest/ }
+        line = source.each_index.find {|i| i > bar && source[i] =~ /assert_true\(true\);/ } + 1
+
+        `./cppunit_test_coverage -p -r --coverage #{index} BarTest`
+        assert_equal(0, $?.exitstatus)
+        content = File.read(index)
+        assert_match(/\ACppUnit coverage index 1\n/, content)
+        file = content[/^file\t(\d+)\t.*cppunit_test\.cpp$/, 1]
+        assert_not_nil(file)
+        lines = content[/^test\tBarTest::testOk\n(?:lines\t.*\n)*?lines\t#{file}\t([^\n]*)/, 1]
+        assert_not_nil(lines)
+        assert(lines.split(',').any? {|range| first, last = range.split('-').map(&:to_i); (first..(last || first)).include?(line) })
+
+        `./cppunit_test_coverage -p -r --coverage #{index} FooTest::testOk`
+        content = File.read(index)
+        assert_match(/^test\tBarTest::testOk$/, content)
+        assert_match(/^test\tFooTest::testOk$/, content)
+      }
+    }
+  end
+
+  def testCppUnitChanged
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      next unless File.exist?('./cppunit_test_coverage')
+      Dir.mktmpdir {|dir|
+        index = File.join(dir, 'cppunit_test.coverage')
+        diff = File.join(dir, 'change.diff')
+        run = `./cppunit_test`[/Run:\s+(\d+)/, 1].to_i
+
+        output = `./cppunit_test_coverage --changed #{index} < /dev/null`
+        assert_match(/Run:\s+#{run}\s+/, output)
+        assert(File.exist?(index))
+
+        line = File.read(index)[/^test\tBarTest::testOk\n(?:lines\t.*\n)*?lines\t0\t(\d+)/, 1]
+        File.write(diff, "diff --git a/test/cppunit_test.cpp b/test/cppunit_test.cpp\n--- a/test/cppunit_test.cpp\n+++ b/test/cppunit_test.cpp\n@@ -#{line} +#{line} @@\n-old\n+new\n")
+        output = `./cppunit_test -V --changed #{index} < #{diff}`
+        assert_match(/BarTest::testOk/, output)
+        assert_match(/OK\s+\(1\stests\)/, output)
+
+        output = `./cppunit_test -V --changed #{index} < /dev/null`
+        assert_equal(0, $?.exitstatus)
+        assert_match(/OK\s+\(0\stests\)/, output)
+        assert_no_match(/LazyTest fixture created/, output)
+
+        partial = File.join(dir, 'partial.coverage')
+        `./cppunit_test_coverage --coverage #{partial} BarTest`
+        output = `./cppunit_test -V --changed #{partial} < /dev/null`
+        assert_no_match(/BarTest::testOk/, output)
+        assert_match(/Run:\s+#{run - 1}\s+/, output)
+      }
+    }
+  end
+
+  def testCppUnitCache
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      Dir.mktmpdir {|dir|
+        begin
+          File.write('cppunit_test.input', 'first')
+          run = `./cppunit_test`[/Run:\s+(\d+)/, 1].to_i
+
+          output = `./cppunit_test -V --cache-dir #{dir}`
+          assert_equal(1, $?.exitstatus)
+          assert_match(/Run:\s+#{run}\s+/, output)
+          assert(File.exist?(File.join(dir, 'results.txt')))
+
+          output = `./cppunit_test -V --cache-dir #{dir}`
+          assert_match(/Run:\s+#{run}\s+/, output)
+          assert_no_match(/BarTest::testOk/, output)
+          assert_match(/FooTest::testFail/, output)
+
+          File.write('cppunit_test.input', 'second')
+          output = `./cppunit_test -V --cache-dir #{dir} BarTest LazyTest`
+          assert_equal(0, $?.exitstatus)
+          assert_no_match(/BarTest::testOk/, output)
+          assert_match(/LazyTest::testOk/, output)
+          assert_match(/OK\s+\(2\stests,\s1\scached\)/, output)
+
+          # The results of other builds are dropped at the end of a run.
+          results = File.join(dir, 'results.txt')
+          File.write(results, "0123456789abcdef\t1\tother-build\tFooTest::testOk\n", mode: 'a')
+          `./cppunit_test --cache-dir #{dir} BarTest`
+          lines = File.readlines(results)
+          assert(lines.none? {|line| line.include?('other-build') })
+          assert_equal(1, lines.map {|line| line.split("\t")[2] }.uniq.size)
+
+          # The input files are resolved against the working directory.
+          executable = File.expand_path('./cppunit_test')
+          Dir.mktmpdir {|other|
+            File.write(File.join(other, 'cppunit_test.input'), 'second')
+            output = Dir.chdir(other) { `#{executable} -V --cache-dir #{dir} LazyTest` }
+            assert_match(/LazyTest::testOk/, output)
+          }
+        ensure
+          File.delete('cppunit_test.input') if File.exist?('cppunit_test.input')
+        end
+      }
+    }
+  end
+
+  def testCppUnitOrder
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      Dir.mktmpdir {|dir|
+        record = File.join(dir, 'order.txt')
+        run = `./cppunit_test`[/Run:\s+(\d+)/, 1].to_i
+
+        output = `./cppunit_test -V --order failed-first --order-file #{record}`
+        assert_match(/Run:\s+#{run}\s+/, output)
+        assert_match(/\AFooTest::testOk/, output[/^\w+::\w+.*/m])
+        assert(File.exist?(record))
+
+        output = `./cppunit_test -V --order failed-first --order-file #{record}`
+        assert_match(/Run:\s+#{run}\s+/, output)
+        tests = output.scan(/^(\w+::\w+)/).flatten
+        assert_equal(['FooTest::testFail', 'FooTest::testThrowNoAssert'], tests[0, 2])
+
+        output = `./cppunit_test -V --order likely-fail --order-file #{record} --fail-fast`
+        assert_equal(1, $?.exitstatus)
+        assert_match(/Run:\s+1\s+/, output)
+        assert_match(/FooTest::testFail/, output)
+      }
+    }
+  end
+
+  def testCppUnitTimeBudget
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      Dir.mktmpdir {|dir|
+        record = File.join(dir, 'order.txt')
+        run = `./cppunit_test`[/Run:\s+(\d+)/, 1].to_i
+
+        output = `./cppunit_test --order-file #{record} --time-budget 1s`
+        assert_match(/Run:\s+#{run}\s+/, output)
+        assert_match(/Time budget not applied: no test duration recorded/, output)
+        assert_no_match(/Deferred/, output)
+
+        output = `./cppunit_test --order-file #{record} --time-budget 1h`
+        assert_match(/Run:\s+#{run}\s+/, output)
+        assert_no_match(/Time budget not applied/, output)
+        assert_no_match(/Deferred/, output)
+
+        File.write(record, "CppUnit test order 2\n" +
+          "run\t1\t0\tbuild\n" +
+          "test\t1\t1\t0\t2000000\tFooTest::testFail\n" +
+          "test\t0\t0\t0\t5000000\tBarTest::testOk\n")
+        output = `./cppunit_test -V --order-file #{record} --time-budget 3s`
+        assert_equal(1, $?.exitstatus)
+        assert_match(/Run:\s+1\s+/, output)
+        assert_match(/^FooTest::testFail/, output)
+        assert_match(/Deferred over the time budget: #{run - 1}/, output)
+        assert_match(/deferred: BarTest::testOk/, output)
+        assert_no_match(/deferred: FooTest::testFail/, output)
+
+        # A budget of zero or too large to count in microseconds is rejected.
+        ['0', '0h', '18446744073709551615', '5124095576030432h'].each {|budget|
+          output = `./cppunit_test --order-file #{record} --time-budget #{budget} 2>&1`
+          assert_equal(1, $?.exitstatus)
+          assert_match(/out of range value for option --time-budget #{budget}$/, output)
+          assert_no_match(/^OK/, output)
+        }
+      }
+    }
+  end
+
+  def testCppUnitBinaryOutput
+    results = File.expand_path(File.join(File.dirname(__FILE__), '..', 'build', 'src', 'cppunit_results', configuration.to_s, 'cppunit_results'))
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      begin
+        `./cppunit_test -b cppunit_test_foo.bin FooTest CaptureTest`
+        assert_equal(1, $?.exitstatus)
+        `./cppunit_test --binary-output cppunit_test_bar.bin --filter '-FooTest::*:-CaptureTest::*'`
+        assert_equal(0, $?.exitstatus)
+
+        output = `#{results} cppunit_test_foo.bin cppunit_test_bar.bin`
+        assert_equal(1, $?.exitstatus)
+        run = `./cppunit_test`[/Run:\s+(\d+)/, 1]
+        assert_match(/Run:\s+#{run}\s+Failures:\s+1\s+Errors:\s+2/, output)
+
+        `#{results} -q -o cppunit_test_all.bin cppunit_test_foo.bin cppunit_test_bar.bin`
+        output = `#{results} -x cppunit_test_all.bin`
+        assert_match(/<Name>FooTest::testFail<\/Name>/, output)
+        assert_match(/<Name>BarTest::testOk<\/Name>/, output)
+
+        output = `#{results} -t cppunit_test_bar.bin`
+        assert_equal(0, $?.exitstatus)
+        assert_match(/OK\s+\(20\stests\)/, output)
+
+        header = File.binread('cppunit_test_bar.bin', 12)
+        File.binwrite('cppunit_test_bad.bin', header + [0xffffffff, 1].pack('VC'))
+        output, error, status = Open3.capture3 "#{results} cppunit_test_bad.bin"
+        assert_equal(2, status.exitstatus)
+        assert_match(/invalid record length/, error)
+
+        File.binwrite('cppunit_test_bad.bin', header + [0x100000, 1].pack('VC') + 'abc')
+        output = `#{results} cppunit_test_bad.bin`
+        assert_equal(0, $?.exitstatus)
+        assert_match(/Run:\s+0\s+/, output)
+      ensure
+        %w(foo bar all bad).each {|name|
+          File.delete("cppunit_test_#{name}.bin") if File.exist?("cppunit_test_#{name}.bin")
+        }
+      end
+    }
+  end
+
+  def testCppUnitHistory
+    history = File.expand_path(File.join(File.dirname(__FILE__), '..', 'build', 'src', 'cppunit_history', configuration.to_s, 'cppunit_history'))
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      Dir.mktmpdir {|dir|
+        3.times {
+          `./cppunit_test --history #{dir}`
+          assert_equal(1, $?.exitstatus)
+        }
+        `./cppunit_test --history #{dir} BarTest`
+        assert_equal(0, $?.exitstatus)
+
+        output = `#{history} #{dir}`
+        assert_equal(0, $?.exitstatus)
+        run = `./cppunit_test`[/Run:\s+(\d+)/, 1].to_i
+        assert_match(/Runs:\s+4\s+Tests:\s+#{run}\s+Results:\s+#{3 * run + 1}/, output)
+
+        %w(-g --slowest-growing -f --flakiest).each {|opt|
+          `#{history} #{opt} -n 3 #{dir}`
+          assert_equal(0, $?.exitstatus)
+        }
+        output = `#{history} --regressions --threshold 0 #{dir}`
+        assert_no_match(/FooTest/, output)
+
+        # The queries do not create a store that does not exist.
+        missing = File.join(dir, 'missing')
+        output, error, status = Open3.capture3 "#{history} #{missing}"
+        assert_equal(2, status.exitstatus)
+        assert_match(/failed to open <#{Regexp.escape(missing)}>/, error)
+        assert(!File.exist?(missing))
+
+        # An interrupted append is dropped, and the next rows stay aligned.
+        duration = File.join(dir, 'duration.col')
+        File.truncate(duration, File.size(duration) - 3)
+        `./cppunit_test --history #{dir} BarTest`
+        rows = File.size(File.join(dir, 'status.col'))
+        assert_equal(3 * run + 1, rows)
+        {'run.col' => 4, 'test.col' => 8, 'duration.col' => 8, 'cputime.col' => 8, 'memory.col' => 8}.each {|column, width|
+          assert_equal(rows * width, File.size(File.join(dir, column)))
+        }
+        assert_equal([4], File.binread(File.join(dir, 'run.col'))[-4..-1].unpack('V'))
+        output = `#{history} #{dir}`
+        assert_match(/Runs:\s+5\s+Tests:\s+#{run}\s+Results:\s+#{3 * run + 1}/, output)
+      }
+    }
+  end
+
+  def testCppUnitCompareWith
+    Dir.chdir(File.join(File.dirname(__FILE__), '..', 'build', 'test', configuration.to_s)) {
+      begin
+        File.write('cppunit_test_previous.xml', `./cppunit_test -x`)
+        output = `./cppunit_test --compare-with cppunit_test_previous.xml`
+        assert_equal(1, $?.exitstatus)
+        assert_match(/New failures:\s+0\s+Fixed:\s+0/, output)
+
+        output, error, status = Open3.capture3 './cppunit_test --compare-with cppunit_test_previous.xml --fail-on-slowdown'
+        assert_match(/has no durations/, error)
+        assert_no_match(/Run:/, output)
+
+        `./cppunit_test -b cppunit_test_previous.bin BarTest`
+        output = `./cppunit_test --compare-with cppunit_test_previous.bin --fail-on-slowdown`
+        assert_match(/New failures:\s+3\s+/, output)
+        assert_match(/new failure: FooTest::testFail/, output)
+        assert_match(/new failure: CaptureTest::testNoisy/, output)
+
+        output, error, status = Open3.capture3 './cppunit_test --compare-with cppunit_test_missing.bin'
+        assert_match(/failed to open/, error)
+      ensure
+        %w(xml bin).each {|ext|
+          File.delete("cppunit_test_previous.#{ext}") if File.exist?("cppunit_test_previous.#{ext}")
+        }
+      end
+    }
+  end
+
   def configuration
     if RUBY_PLATFORM =~ /mswin|mingw/
       ENV['CONFIGURAtION'] || 'Debug'
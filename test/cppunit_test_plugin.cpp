@@ -0,0 +1,55 @@
+#include "cppunit/extensions/HelperMacros.h"
+#include "cppunit/plugin/TestPlugIn.h"
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+namespace
+{
+	std::string plugInParameters;
+	bool isInitialized = false;
+}
+
+class PlugInTest : public CppUnit::TestFixture
+{
+	CPPUNIT_TEST_SUITE(PlugInTest);
+	CPPUNIT_TEST(testOk);
+	CPPUNIT_TEST(testParameters);
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+	PlugInTest()
+		: wasInitialized(isInitialized)
+	{
+	}
+	void testOk()
+	{
+		assert_true(wasInitialized);
+	}
+	void testParameters()
+	{
+		if(plugInParameters == "crash")
+			::abort();
+		assert_equal(std::string(), plugInParameters);
+	}
+
+private:
+	bool wasInitialized;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(PlugInTest);
+
+class PlugIn : public CppUnit::TestPlugInDefaultImpl
+{
+public:
+	void initialize(CppUnit::TestFactoryRegistry*, const CppUnit::PlugInParameters& parameters)
+	{
+		plugInParameters = parameters.getCommandLine();
+		if(plugInParameters == "throw")
+			throw std::runtime_error("bad parameters");
+		isInitialized = true;
+		std::cout << "PlugIn initialized" << std::endl;
+	}
+};
+
+CPPUNIT_PLUGIN_EXPORTED_FUNCTION_IMPL(PlugIn);